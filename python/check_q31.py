@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#  check_q31.py
+#
+#  Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+#
+#  This program is free software; you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation; either version 2 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program; if not, write to the Free Software
+#  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+#  MA 02110-1301, USA.
+
+"""Check the fixed point filter bank against the float one.
+
+Runs Analyzer(fs, arith='q31') and Analyzer(fs) on tones, noise and DC at
+each built-in sample rate and compares the frames in dB (20 log10 of the
+frame values, as shown by the visualizer), band by band. The tolerance is the
+one documented in the README: 0.05 dB where the float level is above -120 dB
+and 0.5 dB down to -150 dB. Quieter bands are not compared.
+
+Usage: PYTHONPATH=python python python/check_q31.py
+Exits with status 1 if any signal is out of tolerance.
+"""
+
+import sys
+import numpy as np
+import pyrtfi
+
+RATES = (44100, 48000, 96000)
+SECONDS = 2
+# (lowest float level in dB, tolerance in dB)
+TOLERANCE = ((-120, 0.05), (-150, 0.5))
+
+def signals(fs):
+	"""Test signals, all below full scale."""
+	t = np.arange(int(fs * SECONDS)) / float(fs)
+	rng = np.random.RandomState(fs)
+
+	yield "tone 1 kHz", 0.5 * np.sin(2 * np.pi * 1000 * t)
+	yield "tone 55 Hz -40 dBFS", 0.01 * np.sin(2 * np.pi * 55 * t)
+	yield "tone 440 Hz -66 dBFS", 5e-4 * np.sin(2 * np.pi * 440 * t)
+	yield "tones 110 Hz + 7 kHz", (0.3 * np.sin(2 * np.pi * 110 * t)
+					+ 0.3 * np.sin(2 * np.pi * 7000 * t))
+	yield "white noise", np.clip(0.1 * rng.randn(len(t)), -1, 1)
+	yield "DC", np.full(len(t), 0.25)
+
+def frames_db(fs, x, arith):
+	a = pyrtfi.Analyzer(fs, arith = arith)
+	f = np.concatenate((a.process(x.astype(np.float32)), a.flush()))
+	with np.errstate(divide = 'ignore'):
+		return 20 * np.log10(f.astype(np.float64))
+
+def check(fs, name, x):
+	"""Returns the largest difference in each level range, and whether they
+	are within the tolerance."""
+	ref = frames_db(fs, x, 'float')
+	q = frames_db(fs, x, 'q31')
+	worst, ok, hi = [], True, np.inf
+
+	with np.errstate(invalid = 'ignore'):
+		diff = np.abs(q - ref)
+
+	for lo, tol in TOLERANCE:
+		sel = (ref > lo) & (ref <= hi)
+		d = np.max(diff[sel]) if np.any(sel) else 0.0
+		worst.append(d)
+		ok = ok and d <= tol
+		hi = lo
+
+	return worst, ok
+
+def main():
+	failed = 0
+
+	print("%-6s %-22s %12s %12s" % ("rate", "signal",
+			"> %d dB" % TOLERANCE[0][0], "> %d dB" % TOLERANCE[1][0]))
+	for fs in RATES:
+		for name, x in signals(fs):
+			worst, ok = check(fs, name, x)
+			failed += not ok
+			print("%-6d %-22s %12.4f %12.4f%s" % (fs, name, worst[0],
+					worst[1], "" if ok else "  FAIL"))
+
+	print("tolerance %s dB: %s" % (" / ".join(str(t) for l, t in TOLERANCE),
+			"FAILED %d" % failed if failed else "ok"))
+	return 1 if failed else 0
+
+if __name__ == '__main__':
+	sys.exit(main())
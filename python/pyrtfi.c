@@ -0,0 +1,654 @@
+/*
+ * pyrtfi.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+/* Python module exposing the filterbank (src/engine.c).
+ *
+ * An Analyzer keeps the filter state between calls, so a signal can be given
+ * in pieces of any length. Samples that do not fill a block are kept until
+ * the next call (or flush()). The engine writes the frames directly into the
+ * returned array, and runs without the GIL. */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <structmember.h>
+#include <numpy/arrayobject.h>
+#include <string.h>
+#include <libjc/common.h>
+#include "../src/engine.h"
+#include "../src/kernels.h"
+
+/* Input samples per block given to the engine. Must be a power of two. */
+#define PY_BLOCK 4096
+
+/* Where the frames go while processing */
+struct frame_out {
+	float *next;
+	long n, cap;
+	/* floats per frame */
+	int len;
+	/* where the frame after the last row goes */
+	float *spare;
+};
+
+typedef struct {
+	PyObject_HEAD
+	struct rtfi_engine *e;
+	int sample_rate, hop;
+	/* planes of the frames, and whether they are given as an axis of
+	 * their own (when the reducers or the widths were chosen) */
+	int planes, split;
+	/* where the engine is left between calls */
+	float frame[RTFI_MAX_SETS * RTFI_MAX_PLANES * N_BANDS];
+	/* samples not yet processed, less than a block */
+	float pending[PY_BLOCK];
+	int n_pending;
+	/* samples processed since the last reset, modulo hop */
+	long phase;
+	/* output of the call in progress, the callback argument */
+	struct frame_out out;
+	/* set while the GIL is released */
+	int busy;
+} Analyzer;
+
+static float *store_frame(void *arg, float *frame)
+{ /* The frame was written in place, the next one goes in the next row */
+	struct frame_out *o = arg;
+
+	(void)frame;
+	o->n++;
+	if (o->n < o->cap) {
+		o->next += o->len;
+		return o->next;
+	}
+
+	/* the output is sized exactly, so this is the frame in progress */
+	return o->spare;
+}
+
+static int Analyzer_init(Analyzer *self, PyObject *args, PyObject *kwds)
+{
+	static char *kwlist[] = {"sample_rate", "coeffs", "arith", "decimator",
+				"align", "hop_ms", "max_hop_ms", "reducers",
+				"widths", "highpass_hz", "shelf_hz", "shelf_db",
+				"octave_db", NULL};
+	PyObject *coeffs = NULL, *reducers = NULL, *widths = NULL;
+	PyObject *octave_db = NULL;
+	struct rtfi_eq eq = {0};
+	PyArrayObject *h = NULL, *a1 = NULL, *k = NULL;
+	const char *arith_name = "float", *dec_name = "fir";
+	const char *align_name = "none";
+	float hop_ms = BLK_SIZE_MS, max_hop_ms = 0;
+	int r = -E_OK, arith, dec, align, red[RTFI_N_REDUCERS], n_red = 0;
+	float w[RTFI_MAX_SETS];
+	int n_w = 0;
+
+	/* run() works on the engine with the GIL released: replacing it now
+	 * would free it under the other thread */
+	if (self->busy) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"analyzer in use by another thread");
+		return -1;
+	}
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwds, "i|OsssffOOfffO", kwlist,
+			&self->sample_rate, &coeffs, &arith_name, &dec_name,
+			&align_name, &hop_ms, &max_hop_ms, &reducers, &widths,
+			&eq.highpass_hz, &eq.shelf_hz, &eq.shelf_db, &octave_db))
+		return -1;
+
+	if ((arith = rtfi_arith(arith_name)) < 0) {
+		PyErr_Format(PyExc_ValueError, "unknown arithmetic: %s",
+								arith_name);
+		return -1;
+	}
+	if ((dec = rtfi_decimator(dec_name)) < 0) {
+		PyErr_Format(PyExc_ValueError, "unknown decimator: %s",
+								dec_name);
+		return -1;
+	}
+	if ((align = rtfi_align(align_name)) < 0) {
+		PyErr_Format(PyExc_ValueError, "unknown alignment: %s",
+								align_name);
+		return -1;
+	}
+
+	if (reducers != NULL && reducers != Py_None) {
+		PyObject *t;
+		Py_ssize_t i;
+
+		if ((t = PySequence_Tuple(reducers)) == NULL)
+			return -1;
+		if (PyTuple_GET_SIZE(t) < 1
+		    || PyTuple_GET_SIZE(t) > RTFI_N_REDUCERS) {
+			PyErr_SetString(PyExc_ValueError, "reducers must have "
+				"one or more of 'mean', 'max', 'last', 'db' "
+								"and 'freq'");
+			Py_DECREF(t);
+			return -1;
+		}
+		for (i = 0; i < PyTuple_GET_SIZE(t); i++) {
+			const char *name = PyUnicode_AsUTF8(
+						PyTuple_GET_ITEM(t, i));
+
+			if (name == NULL || (red[i] = rtfi_reducer(name)) < 0) {
+				if (name != NULL)
+					PyErr_Format(PyExc_ValueError,
+						"unknown reducer: %s", name);
+				Py_DECREF(t);
+				return -1;
+			}
+		}
+		n_red = (int)i;
+		Py_DECREF(t);
+	}
+
+	if (widths != NULL && widths != Py_None) {
+		PyObject *t;
+		Py_ssize_t i;
+
+		if ((t = PySequence_Tuple(widths)) == NULL)
+			return -1;
+		for (i = 0; i < PyTuple_GET_SIZE(t) && i < RTFI_MAX_SETS; i++) {
+			w[i] = (float)PyFloat_AsDouble(PyTuple_GET_ITEM(t, i));
+			if (w[i] == -1 && PyErr_Occurred()) {
+				Py_DECREF(t);
+				return -1;
+			}
+		}
+		/* one too many is enough for rtfi_engine_set_widths to refuse */
+		n_w = (i < PyTuple_GET_SIZE(t))? RTFI_MAX_SETS + 1 : (int)i;
+		Py_DECREF(t);
+	}
+
+	if (octave_db != NULL && octave_db != Py_None) {
+		PyObject *t;
+		Py_ssize_t i;
+
+		if ((t = PySequence_Tuple(octave_db)) == NULL)
+			return -1;
+		if (PyTuple_GET_SIZE(t) > RTFI_STEPS) {
+			PyErr_Format(PyExc_ValueError, "octave_db has more than "
+					"%d values", RTFI_STEPS);
+			Py_DECREF(t);
+			return -1;
+		}
+		for (i = 0; i < PyTuple_GET_SIZE(t); i++) {
+			PyObject *g = PyTuple_GET_ITEM(t, i);
+
+			eq.octave_db[i] = (float)PyFloat_AsDouble(g);
+			if (eq.octave_db[i] == -1 && PyErr_Occurred()) {
+				Py_DECREF(t);
+				return -1;
+			}
+		}
+		Py_DECREF(t);
+	}
+
+	if (coeffs != NULL && coeffs != Py_None) {
+		PyObject *t, *oh, *oa, *ok;
+
+		if ((t = PySequence_Tuple(coeffs)) == NULL)
+			return -1;
+		if (!PyArg_ParseTuple(t, "OOO", &oh, &oa, &ok)) {
+			Py_DECREF(t);
+			return -1;
+		}
+
+		h = (PyArrayObject *)PyArray_FROM_OTF(oh, NPY_FLOAT32,
+					NPY_ARRAY_IN_ARRAY | NPY_ARRAY_FORCECAST);
+		a1 = (PyArrayObject *)PyArray_FROM_OTF(oa, NPY_COMPLEX64,
+					NPY_ARRAY_IN_ARRAY | NPY_ARRAY_FORCECAST);
+		k = (PyArrayObject *)PyArray_FROM_OTF(ok, NPY_FLOAT32,
+					NPY_ARRAY_IN_ARRAY | NPY_ARRAY_FORCECAST);
+		Py_DECREF(t);
+		if (h == NULL || a1 == NULL || k == NULL)
+			goto fail;
+
+		if (PyArray_SIZE(h) != DFILTER_N / 2 || PyArray_SIZE(a1) != BLOCK
+		    || PyArray_SIZE(k) != BLOCK) {
+			PyErr_Format(PyExc_ValueError, "coeffs must be "
+				"(decfilter[%d], a1[%d], k[%d])", DFILTER_N / 2,
+				BLOCK, BLOCK);
+			goto fail;
+		}
+	}
+
+	rtfi_engine_free(self->e);
+	if (h != NULL)
+		self->e = rtfi_engine_new_coeffs(self->sample_rate,
+				PyArray_DATA(h), PyArray_DATA(a1),
+				PyArray_DATA(k), PY_BLOCK, self->frame,
+				store_frame, &self->out, &r);
+	else
+		self->e = rtfi_engine_new(self->sample_rate, PY_BLOCK,
+				self->frame, store_frame, &self->out, &r);
+
+	if (self->e == NULL) {
+		if (r == -E_BADCFG)
+			PyErr_Format(PyExc_ValueError,
+				"unsupported sample rate: %d", self->sample_rate);
+		else
+			PyErr_NoMemory();
+		goto fail;
+	}
+
+	if ((r = rtfi_engine_set_hop(self->e, hop_ms, max_hop_ms)) != -E_OK
+	    || (r = rtfi_engine_set_decimator(self->e, dec)) != -E_OK
+	    || (r = rtfi_engine_set_arith(self->e, arith)) != -E_OK
+	    || (r = rtfi_engine_set_align(self->e, align)) != -E_OK) {
+		if (r == -E_BADCFG)
+			PyErr_SetString(PyExc_ValueError, "the IIR decimator "
+				"needs the built-in coefficients and float "
+								"arithmetic");
+		else if (r == -E_BADARGS)
+			PyErr_SetString(PyExc_ValueError, "hop_ms must be at "
+				"most 1000, and at least RTFI_MIN_HOP (32) "
+							"samples");
+		else
+			PyErr_NoMemory();
+		goto fail;
+	}
+
+	if (n_red > 0 && (r = rtfi_engine_set_reducers(self->e, red, n_red,
+						self->frame)) != -E_OK) {
+		if (r == -E_BADARGS)
+			PyErr_SetString(PyExc_ValueError,
+					"a reducer is given more than once");
+		else
+			PyErr_NoMemory();
+		goto fail;
+	}
+
+	if ((r = rtfi_engine_set_eq(self->e, &eq)) != -E_OK) {
+		if (r == -E_BADARGS)
+			PyErr_SetString(PyExc_ValueError, "the equalizer "
+				"frequencies must be below half the sample rate");
+		else
+			PyErr_NoMemory();
+		goto fail;
+	}
+
+	if (n_w > 0 && (r = rtfi_engine_set_widths(self->e, w, n_w,
+						self->frame)) != -E_OK) {
+		if (r == -E_BADARGS)
+			PyErr_Format(PyExc_ValueError, "widths must have 1 to "
+				"%d values, more than 0 and up to %d",
+					RTFI_MAX_SETS, RTFI_MAX_WIDTH);
+		else
+			PyErr_NoMemory();
+		goto fail;
+	}
+
+	self->planes = rtfi_engine_frame_len(self->e) / N_BANDS;
+	self->split = (n_red > 0 || n_w > 0);
+	self->hop = rtfi_engine_hop(self->e);
+	self->n_pending = 0;
+	self->phase = 0;
+	Py_XDECREF(h);
+	Py_XDECREF(a1);
+	Py_XDECREF(k);
+	return 0;
+
+fail:
+	Py_XDECREF(h);
+	Py_XDECREF(a1);
+	Py_XDECREF(k);
+	return -1;
+}
+
+static void Analyzer_dealloc(Analyzer *self)
+{
+	rtfi_engine_free(self->e);
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int check_ready(Analyzer *self)
+{
+	if (self->e == NULL) {
+		PyErr_SetString(PyExc_RuntimeError, "analyzer not initialized");
+		return 0;
+	}
+	if (self->busy) {
+		PyErr_SetString(PyExc_RuntimeError,
+				"analyzer in use by another thread");
+		return 0;
+	}
+	return 1;
+}
+
+static PyObject *run(Analyzer *self, const float *x, npy_intp n, int flush)
+{ /* Process the pending samples followed by x. If flush is set, the last
+	block is completed with zeros. Returns a (frames, N_BANDS) array, or
+	(frames, planes, N_BANDS) if the reducers were chosen. */
+	struct frame_out *out = &self->out;
+	struct rtfi_engine *e = self->e;
+	PyArrayObject *res;
+	npy_intp dims[3], total = self->n_pending + n, n_run, i = 0;
+
+	n_run = flush? (total + PY_BLOCK - 1) / PY_BLOCK * PY_BLOCK
+		     : total / PY_BLOCK * PY_BLOCK;
+	dims[0] = (self->phase + n_run) / self->hop;
+	dims[1] = self->split? self->planes : N_BANDS;
+	dims[2] = N_BANDS;
+
+	if ((res = (PyArrayObject *)PyArray_ZEROS(self->split? 3 : 2, dims,
+						NPY_FLOAT32, 0)) == NULL)
+		return NULL;
+
+	out->next = PyArray_DATA(res);
+	out->len = self->planes * N_BANDS;
+	out->n = 0;
+	out->cap = dims[0];
+	out->spare = self->frame;
+	if (dims[0] > 0)
+		rtfi_engine_set_frame(e, out->next);
+
+	self->busy = 1;
+	Py_BEGIN_ALLOW_THREADS
+
+	/* complete the pending block first */
+	if (self->n_pending > 0 && total >= PY_BLOCK) {
+		i = PY_BLOCK - self->n_pending;
+		memcpy(self->pending + self->n_pending, x,
+						(size_t)i * sizeof(*x));
+		rtfi_engine_run(e, self->pending, PY_BLOCK);
+		self->n_pending = 0;
+	}
+
+	for (; self->n_pending == 0 && n - i >= PY_BLOCK; i += PY_BLOCK)
+		rtfi_engine_run(e, (float *)x + i, PY_BLOCK);
+
+	/* keep the rest */
+	if (n > i) {
+		memcpy(self->pending + self->n_pending, x + i,
+						(size_t)(n - i) * sizeof(*x));
+		self->n_pending += (int)(n - i);
+	}
+
+	if (flush && self->n_pending > 0) {
+		memset(self->pending + self->n_pending, 0,
+			(size_t)(PY_BLOCK - self->n_pending)
+						* sizeof(*self->pending));
+		rtfi_engine_run(e, self->pending, PY_BLOCK);
+		self->n_pending = 0;
+	}
+
+	rtfi_engine_set_frame(e, self->frame);
+	Py_END_ALLOW_THREADS
+	self->busy = 0;
+
+	self->phase = (self->phase + n_run) % self->hop;
+
+	return (PyObject *)res;
+}
+
+static PyObject *Analyzer_process(Analyzer *self, PyObject *args)
+{
+	PyObject *obj, *res;
+	PyArrayObject *x;
+
+	if (!PyArg_ParseTuple(args, "O", &obj) || !check_ready(self))
+		return NULL;
+
+	/* no copy if it already is a contiguous float32 array */
+	x = (PyArrayObject *)PyArray_FROM_OTF(obj, NPY_FLOAT32,
+					NPY_ARRAY_IN_ARRAY | NPY_ARRAY_FORCECAST);
+	if (x == NULL)
+		return NULL;
+	if (PyArray_NDIM(x) != 1) {
+		PyErr_SetString(PyExc_ValueError, "input must be 1-D");
+		Py_DECREF(x);
+		return NULL;
+	}
+
+	res = run(self, PyArray_DATA(x), PyArray_SIZE(x), 0);
+	Py_DECREF(x);
+	return res;
+}
+
+static PyObject *Analyzer_flush(Analyzer *self, PyObject *unused)
+{
+	(void)unused;
+	if (!check_ready(self))
+		return NULL;
+
+	return run(self, NULL, 0, 1);
+}
+
+static PyObject *Analyzer_reset(Analyzer *self, PyObject *unused)
+{
+	(void)unused;
+	if (!check_ready(self))
+		return NULL;
+
+	rtfi_engine_reset(self->e);
+	self->n_pending = 0;
+	self->phase = 0;
+	Py_RETURN_NONE;
+}
+
+static PyObject *Analyzer_delays(Analyzer *self, PyObject *unused)
+{
+	PyObject *l;
+	int i;
+
+	(void)unused;
+	if (!check_ready(self) || (l = PyList_New(RTFI_STEPS)) == NULL)
+		return NULL;
+
+	for (i = 0; i < RTFI_STEPS; i++) {
+		PyObject *d = PyFloat_FromDouble(rtfi_engine_delay(self->e, i));
+
+		if (d == NULL) {
+			Py_DECREF(l);
+			return NULL;
+		}
+		PyList_SET_ITEM(l, i, d);
+	}
+
+	return l;
+}
+
+static PyObject *Analyzer_octave_hops(Analyzer *self, PyObject *unused)
+{
+	PyObject *l;
+	int i;
+
+	(void)unused;
+	if (!check_ready(self) || (l = PyList_New(RTFI_STEPS)) == NULL)
+		return NULL;
+
+	for (i = 0; i < RTFI_STEPS; i++) {
+		PyObject *m = PyLong_FromLong(rtfi_engine_octave_hop(self->e, i));
+
+		if (m == NULL) {
+			Py_DECREF(l);
+			return NULL;
+		}
+		PyList_SET_ITEM(l, i, m);
+	}
+
+	return l;
+}
+
+static PyMethodDef Analyzer_methods[] = {
+	{"process", (PyCFunction)Analyzer_process, METH_VARARGS,
+	 "process(x) -> frames\n\n"
+	 "Analyze the samples in x (1-D, converted to float32) and return the\n"
+	 "frames completed, as a (n, N_BANDS) float32 array. Values are the\n"
+	 "mean power of each band; 20*log10 gives the level in dB as shown by\n"
+	 "the visualizer. Band 0 is the highest. With reducers or widths the\n"
+	 "array is (n, planes, N_BANDS): for each width in the order given,\n"
+	 "a plane for each reducer in the order given and two (real,\n"
+	 "imaginary) for 'last'."},
+	{"flush", (PyCFunction)Analyzer_flush, METH_NOARGS,
+	 "flush() -> frames\n\n"
+	 "Process the samples kept from previous calls, padded with zeros."},
+	{"reset", (PyCFunction)Analyzer_reset, METH_NOARGS,
+	 "reset()\n\nClear the filter state and the kept samples."},
+	{"delays", (PyCFunction)Analyzer_delays, METH_NOARGS,
+	 "delays() -> list\n\n"
+	 "Delay of each octave (BLOCK bands, the highest first) in samples,\n"
+	 "including the alignment."},
+	{"octave_hops", (PyCFunction)Analyzer_octave_hops, METH_NOARGS,
+	 "octave_hops() -> list\n\n"
+	 "How many frames each octave is averaged over (a power of two)."},
+	{NULL}
+};
+
+static PyMemberDef Analyzer_members[] = {
+	{"sample_rate", T_INT, offsetof(Analyzer, sample_rate), READONLY,
+	 "Input sample rate"},
+	{"hop", T_INT, offsetof(Analyzer, hop), READONLY,
+	 "Input samples per frame"},
+	{NULL}
+};
+
+static PyTypeObject AnalyzerType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	.tp_name = "pyrtfi.Analyzer",
+	.tp_doc = "Analyzer(sample_rate, coeffs=None, arith='float',\n"
+		"         decimator='fir', align='none', hop_ms=10,\n"
+		"         max_hop_ms=0, reducers=None, widths=None,\n"
+		"         highpass_hz=0, shelf_hz=0, shelf_db=0,\n"
+		"         octave_db=None)\n\n"
+		"RTFI filterbank. coeffs is (decfilter, a1, k) as returned by\n"
+		"engine_params() in scripts/rtfi.py; by default the built-in\n"
+		"coefficients for the sample rate are used. arith is 'float'\n"
+		"or 'q31' (fixed point), decimator 'fir' or 'iir' (allpass\n"
+		"half-band, only with the built-in coefficients) and align\n"
+		"'none', 'decimators' or 'full' (see delays()). Frames are\n"
+		"hop_ms apart; the lower octaves are averaged over up to\n"
+		"max_hop_ms (see octave_hops()). reducers is a sequence of\n"
+		"what the frames hold: 'mean' (power, the default), 'max'\n"
+		"(power), 'last' (complex output), 'db' (of the mean) or\n"
+		"'freq' (instantaneous frequency, Hz). widths runs several\n"
+		"sets of resonators, with the bandwidths of the coefficients\n"
+		"times each width, on the same decimated signal. The input is\n"
+		"equalized with a high pass from highpass_hz and a low shelf\n"
+		"of shelf_db below shelf_hz (0 for none), and the octaves,\n"
+		"the top one first, get the gains in octave_db.",
+	.tp_basicsize = sizeof(Analyzer),
+	.tp_flags = Py_TPFLAGS_DEFAULT,
+	.tp_new = PyType_GenericNew,
+	.tp_init = (initproc)Analyzer_init,
+	.tp_dealloc = (destructor)Analyzer_dealloc,
+	.tp_methods = Analyzer_methods,
+	.tp_members = Analyzer_members,
+};
+
+static PyObject *coefficients(PyObject *module, PyObject *args)
+{ /* Built-in coefficients, as copies */
+	const float *h, *a1, *k;
+	npy_intp nh = DFILTER_N / 2, nb = BLOCK;
+	PyObject *oh, *oa, *ok;
+	int sample_rate;
+
+	(void)module;
+	if (!PyArg_ParseTuple(args, "i", &sample_rate))
+		return NULL;
+	if (rtfi_builtin_coeffs(sample_rate, &h, &a1, &k) != -E_OK) {
+		PyErr_Format(PyExc_ValueError, "unsupported sample rate: %d",
+								sample_rate);
+		return NULL;
+	}
+
+	oh = PyArray_SimpleNew(1, &nh, NPY_FLOAT32);
+	oa = PyArray_SimpleNew(1, &nb, NPY_COMPLEX64);
+	ok = PyArray_SimpleNew(1, &nb, NPY_FLOAT32);
+	if (oh == NULL || oa == NULL || ok == NULL) {
+		Py_XDECREF(oh);
+		Py_XDECREF(oa);
+		Py_XDECREF(ok);
+		return NULL;
+	}
+	memcpy(PyArray_DATA((PyArrayObject *)oh), h, (size_t)nh * sizeof(*h));
+	memcpy(PyArray_DATA((PyArrayObject *)oa), a1,
+						(size_t)(2 * nb) * sizeof(*a1));
+	memcpy(PyArray_DATA((PyArrayObject *)ok), k, (size_t)nb * sizeof(*k));
+
+	return Py_BuildValue("(NNN)", oh, oa, ok);
+}
+
+static PyObject *kernels(PyObject *module, PyObject *args)
+{ /* Select the kernels, or only tell which ones are in use */
+	const char *name = NULL;
+	int r;
+
+	(void)module;
+	if (!PyArg_ParseTuple(args, "|s", &name))
+		return NULL;
+
+	if (name != NULL && (r = kernels_select(name)) != -E_OK) {
+		PyErr_Format(PyExc_ValueError, (r == -E_BADCFG)?
+			"kernels not supported by this processor: %s"
+			: "unknown kernels: %s", name);
+		return NULL;
+	}
+
+	return PyUnicode_FromString(kern->name);
+}
+
+static PyMethodDef module_methods[] = {
+	{"coefficients", coefficients, METH_VARARGS,
+	 "coefficients(sample_rate) -> (decfilter, a1, k)\n\n"
+	 "The built-in coefficients for a sample rate."},
+	{"kernels", kernels, METH_VARARGS,
+	 "kernels([name]) -> name\n\n"
+	 "The instruction set used. If name is given ('auto', 'base', 'avx2'\n"
+	 "or 'avx512'), select it first. Do not change it while analyzing."},
+	{NULL}
+};
+
+static struct PyModuleDef pyrtfi_module = {
+	PyModuleDef_HEAD_INIT,
+	.m_name = "pyrtfi",
+	.m_doc = "Resonator time-frequency image filterbank",
+	.m_size = -1,
+	.m_methods = module_methods,
+};
+
+PyMODINIT_FUNC PyInit_pyrtfi(void)
+{
+	PyObject *m;
+
+	import_array();
+	kernels_select(NULL);
+
+	if (PyType_Ready(&AnalyzerType) < 0)
+		return NULL;
+	if ((m = PyModule_Create(&pyrtfi_module)) == NULL)
+		return NULL;
+
+	Py_INCREF(&AnalyzerType);
+	if (PyModule_AddObject(m, "Analyzer", (PyObject *)&AnalyzerType) < 0) {
+		Py_DECREF(&AnalyzerType);
+		Py_DECREF(m);
+		return NULL;
+	}
+
+	PyModule_AddIntConstant(m, "N_BANDS", N_BANDS);
+	PyModule_AddIntConstant(m, "REAL_N_BANDS", REAL_N_BANDS);
+	PyModule_AddIntConstant(m, "FXST", FXST);
+
+	return m;
+}
@@ -0,0 +1,50 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#  setup.py
+#
+#  Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+#
+#  This program is free software; you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation; either version 2 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program; if not, write to the Free Software
+#  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+#  MA 02110-1301, USA.
+
+"""Build the pyrtfi module from the same filterbank sources as the programs.
+
+Usage: python setup.py build_ext --inplace
+"""
+
+import os.path
+import numpy as np
+from setuptools import setup, Extension
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TOP = os.path.dirname(HERE)
+
+pyrtfi = Extension('pyrtfi',
+		sources = [os.path.join(HERE, 'pyrtfi.c')]
+			+ [os.path.join(TOP, 'src', f) for f in ('engine.c',
+				'kernels.c', 'kernels_avx2.c', 'kernels_avx512.c',
+				'dispatch.c')],
+		include_dirs = [os.path.join(TOP, 'extra_libs')],
+		define_macros = [('_DEFAULT_SOURCE', None)],
+		# the same warnings as WFLAGS in the Makefile; numpy's headers
+		# are not pedantic clean, so they are system headers here
+		extra_compile_args = ['-std=c99', '-O3', '-pedantic', '-Wall',
+					'-Wextra', '-Wconversion',
+					'-isystem', np.get_include()])
+
+setup(name = 'pyrtfi', version = '1.0',
+	description = 'Resonator time-frequency image filterbank',
+	ext_modules = [pyrtfi])
@@ -94,6 +94,15 @@ def iso226(phon, freqs = None):
 		else:
 			return interp1d(f, Lp, 'cubic')(freqs)
 
+def loudness_level(spl, freqs, phons = range(20, 91)):
+	"""Loudness level in phon of tones of each SPL (rows) and frequency
+	(columns), interpolated between the contours of the given phon values.
+	Outside of them the loudness level is clamped to the first or last."""
+	contours = np.array([iso226(p, freqs) for p in phons])
+
+	return np.array([[np.interp(l, contours[:, j], phons)
+				for j in range(len(freqs))] for l in spl])
+
 def test_plot():
 	import matplotlib.pyplot as plt
 
@@ -25,7 +25,7 @@ import os.path
 import numpy as np
 import scipy.signal as sig
 from textwrap import wrap
-from iso226 import iso226
+from iso226 import iso226, loudness_level
 
 # Resonator Time-Frequency Image
 # This code calculates the parameters for a RTFI, as described in:
@@ -129,8 +129,26 @@ def filter_coeffs(f0, fr_w, fs):
 	return a1, k
 
 def resonator_run(a1, k, x):
-	#y =
-	pass
+	"""Run a bank of resonators over the signal x.
+
+	This is the direct (slow) form of what the C engine does on each
+	decimated stream, useful to check it.
+
+	Parameters
+	----------
+
+	a1, k: filter coefficients, as returned by filter_coeffs.
+	x: input signal.
+
+	Returns
+	-------
+
+	y: complex array of shape (len(a1), len(x)) with the output of each
+		resonator.
+	"""
+	x = np.asarray(x, dtype = complex)
+	return np.array([sig.lfilter([kk], [1, -aa], x)
+			for aa, kk in zip(np.atleast_1d(a1), np.atleast_1d(k))])
 
 def decimator_design(f0, fr_w, fs, att, force_n = None):
 	"""Design a low-pass decimating filter (using kaiser window) suitable for
@@ -160,7 +178,7 @@ def decimator_design(f0, fr_w, fs, att, force_n = None):
 	fstop: beggining of the stop-band in Hz.
 	h: impulse response.
 	"""
-	fpass = f0[-1] + frw[-1]/(2*np.pi)
+	fpass = f0[-1] + fr_w[-1]/(2*np.pi)
 	fstop = fs/2 - fpass
 
 	n, beta = sig.kaiserord(att, 2*(fstop-fpass)/float(fs))
@@ -171,10 +189,85 @@ def decimator_design(f0, fr_w, fs, att, force_n = None):
 		else:
 			n = force_n
 
-	h = sig.firwin(n, (fstop+fpass)/2, fstop-fpass,'kaiser', nyq = fs/2)
+	h = sig.firwin(n, (fstop+fpass)/2, width = fstop-fpass, window = 'kaiser',
+				fs = fs)
 
 	return fpass, fstop, h
 
+def _series(q, c, order, n0, power, trig, sign):
+	"""Theta function series of the elliptic half-band design."""
+	acc = 0
+	i = n0
+	while True:
+		term = sign * q**power(i) * trig(c, i)
+		acc += term
+		sign = -sign
+		i += 1
+		if abs(term) < 1e-100:
+			return acc
+
+def halfband_design(f0, fr_w, fs, att, force_n = None):
+	"""Design a decimating half-band filter made of two parallel chains of
+	allpass sections, as an alternative to decimator_design().
+
+	The filter is H(z) = (A0(z^2) + z^-1 A1(z^2)) / 2, where A0 and A1 are
+	products of sections (a + z^-2)/(1 + a z^-2). It is an elliptic filter
+	(Valenzuela and Constantinides), so it has the least number of sections
+	for a given attenuation and transition band. The phase is not linear.
+
+	Parameters
+	----------
+
+	f0, fr_w, fs, att: as in decimator_design. The pass band edge is the
+		same, the stop band edge is symmetric around fs/4.
+	force_n: Fix the number of sections, as in decimator_design.
+
+	Returns
+	-------
+
+	fpass: end of the pass-band in Hz.
+	fstop: beggining of the stop-band in Hz.
+	a: coefficients, a[0], a[2], ... form A0 and a[1], a[3], ... form A1.
+	"""
+	fpass = f0[-1] + fr_w[-1]/(2*np.pi)
+	fstop = fs/2 - fpass
+
+	k = np.tan(np.pi/4 - np.pi*(fstop-fpass)/(2*fs))**2
+	kk = (1 - k*k)**0.25
+	e = (1 - kk) / (2*(1 + kk))
+	q = e*(1 + e**4*(2 + e**4*(15 + 150*e**4)))
+
+	a2 = 10**(-att/10.0) / (1 - 10**(-att/10.0))
+	n = max(1, int(np.ceil(np.log(a2*a2/16) / np.log(q))) // 2)
+
+	if force_n is not None:
+		if force_n < n:
+			raise Exception('Required order is more than specified')
+		else:
+			n = force_n
+
+	order = 2*n + 1
+	a = []
+	for c in range(1, n + 1):
+		num = q**0.25 * _series(q, c, order, 0, lambda i: i*(i+1),
+			lambda c, i: np.sin((2*i+1)*c*np.pi/order), 1)
+		den = 0.5 + _series(q, c, order, 1, lambda i: i*i,
+			lambda c, i: np.cos(2*i*c*np.pi/order), -1)
+		w2 = (num/den)**2
+		x = np.sqrt((1 - w2*k)*(1 - w2/k)) / (1 + w2)
+		a.append((1 - x)/(1 + x))
+
+	return fpass, fstop, np.array(a)
+
+def halfband_run(a, x):
+	"""Decimate x (of even length) with the filter of halfband_design, as
+	the engine does."""
+	def chain(coeffs, s):
+		for c in coeffs:
+			s = sig.lfilter([c, 1], [1, c], s)
+		return s
+
+	return (chain(a[0::2], x[1::2]) + chain(a[1::2], x[0::2])) / 2
 
 FS = [44100, 48000, 96000] # sampling frequencies
 FXST = 10 # filter per semitone
@@ -186,7 +279,9 @@ BLOCK = FXST*OCTAVE
 FILENAME = "rtfi_params.c"
 AUXFILENAME = "rtfi_defines.h"
 SPECFILE = "spectral_tables.c"
+KERNELFILE = "rtfi_kernels.c"
 ISOPHON = 70.0
+ISO_PHONS = range(20, 91) # contours of the loudness weights
 N_HARM = 10
 
 file_header = """/*
@@ -223,6 +318,7 @@ const int RTFI_SAMPLERATES[%d] = { %s };
 struct_def = """
 struct rtfi_param {
 	float decfilter[DFILTER_N / 2]; /* we use an even, symmetric FIR */
+	float apfilter[APF_N]; /* or the allpass half-band, see rtfi.py */
 	complex float a1[BLOCK];
 	float k[BLOCK];
 };
@@ -233,6 +329,8 @@ static const struct rtfi_param rtfi_{fs!s} =
 {{
 	.decfilter = {{ {h}
 	}},
+	.apfilter = {{ {ap}
+	}},
 	.a1 = {{ {a1}
 	}},
 	.k = {{ {k}
@@ -248,14 +346,22 @@ defines_footer = """
 #endif /* __%s__ */ /* End of automatically generated definitions */
 """
 
-spec_header = """/* ISO226 Equal loudness contour.
-Calculated for %f phon. Interpolated using cubic splines.
+spec_header = """/* ISO226 Equal loudness contours.
+Weights of each level for the contours of %d to %d phon, interpolated using
+cubic splines, and zero at the minimum of the %f phon contour.
 Automatically generated file. DO NOT edit
-iso226[0] -> highest frequency */
+iso_weight[l][0] -> highest frequency */
 """
 
-isoarray = """static const float iso226[N_BANDS] = {{
-	{curve}
+isotable = """
+/* Rows of levels of 1 dB SPL from ISO_LEVEL0, columns of the bands of each
+ * semitone (and the next one below the last) */
+#define ISO_LEVEL0 {level0}
+#define ISO_ROWS {rows}
+#define ISO_COLS {cols}
+
+static const float iso_weight[ISO_ROWS][ISO_COLS] = {{
+	{table}
 }};
 """
 
@@ -263,6 +369,64 @@ spec_footer = """
 /* End of automatically generated file */
 """
 
+configs_template = """
+/* Indexed by configuration id, the same as RTFI_SAMPLERATES */
+static const struct rtfi_param *const rtfi_configs[RTFI_N_CONFIGS] = {{
+	{configs}
+}};
+"""
+
+kernel_header = """/* Kernels specialized for the built-in configurations, see src/kernels.h.
+Included by src/kernels.c, once for each instruction set.
+Automatically generated file. DO NOT edit */
+"""
+
+decimate_template = """
+static void decimate_{fs!s}(const float *restrict src, int j0, int n,
+							float *restrict dst)
+{{
+	int o;
+
+	for (o = j0 / 2; o < (n + 1) / 2; o++) {{
+		const float *s = src + 2*o;
+
+		dst[o] = {taps};
+	}}
+}}
+"""
+
+resonate_template = """
+static void resonate_{name}(const float *restrict ar, const float *restrict ai,
+		const float *restrict k, float *restrict yr, float *restrict yi,
+		const float *restrict src, int n, float *restrict acc)
+{{ /* Bands {lo} to {hi}. The complex product is written out so that it is
+	computed exactly as k*x + a1*y would be. */
+	int i, b;
+
+	for (b = {lo}; b < {hi}; b++)
+		acc[b] = 0;
+
+	for (i = 0; i < n; i++) {{
+		const float x = src[i];
+
+		for (b = {lo}; b < {hi}; b++) {{
+			float re = k[b]*x + (ar[b]*yr[b] - ai[b]*yi[b]);
+			float im = ar[b]*yi[b] + ai[b]*yr[b];
+
+			yr[b] = re;
+			yi[b] = im;
+			acc[b] += re*re + im*im;
+		}}
+	}}
+}}
+"""
+
+kernel_footer = """
+#define RTFI_DECIMATE_CONFIGS {{ {decimators} }}
+
+/* End of automatically generated file */
+"""
+
 hindex_template = """
 static const int hindex[N_HARM - 1] = {{
 	{hi}
@@ -282,7 +446,9 @@ def list2carray(l):
 	"""Convert a numpy array into a C array for inclusion in a source file."""
 	return "\n\t".join(wrap(", ".join(number2str(x) for x in l)))
 
-def create_params(f0, frw, fs, att, n):
+def params(f0, frw, fs, att, n):
+	"""Compute the half decimating filter and the coefficients of the top
+	octave, as stored in struct rtfi_param."""
 	upper_f0 = f0[-BLOCK:]
 	upper_frw = frw[-BLOCK:]
 
@@ -294,18 +460,69 @@ def create_params(f0, frw, fs, att, n):
 
 	h = h[:len(h)//2] # remove redundancies
 
+	return h, a1, k
+
+def create_params(f0, frw, fs, att, n, apn):
+	h, a1, k = params(f0, frw, fs, att, n)
+	ap = halfband_design(f0, frw, fs, att, apn)[-1]
+
 	return param_template.format(fs = fs, h = list2carray(h),
-				a1 = list2carray(a1), k = list2carray(k))
+				ap = list2carray(ap), a1 = list2carray(a1),
+				k = list2carray(k))
+
+def engine_params(fs, att = ATT):
+	"""Compute the coefficients for a sample rate, in the form taken by the
+	pyrtfi module: pyrtfi.Analyzer(fs, engine_params(fs)).
+
+	The filter order is the one of the built-in tables (DFILTER_N), so fs
+	cannot be less than min(FS).
+
+	Returns
+	-------
+
+	(h, a1, k): half of the decimating filter (float32), resonator parameters
+		(complex64) and gains (float32) of the top octave.
+	"""
+	f0, frw, p = const_q(PINIT, PEND, FXST)
+	maxn = len(decimator_design(f0, frw, min(FS), att)[-1])
+	h, a1, k = params(f0, frw, fs, att, maxn)
+
+	return (h.astype(np.float32), a1.astype(np.complex64),
+							k.astype(np.float32))
+
+def create_decimator(h, fs):
+	"""Emit the decimating FIR for one configuration, with the taps unrolled
+	and the coefficients as constants. h is the first half of the filter.
+	The taps are added in the same order as in the generic kernel."""
+	n = 2 * len(h)
+	taps = ["%s*(s[%d] + s[%d])" % (number2str(c), -i, i - (n - 1))
+							for i, c in enumerate(h)]
+	return decimate_template.format(fs = fs, taps = "\n\t\t\t+ ".join(taps))
+
+def create_resonator(name, lo, hi):
+	return resonate_template.format(name = name, lo = lo, hi = hi)
 
 def normiso(f0):
 	"""Get a iso226 curve normalized so that the minimum value is zero."""
 	x = iso226(ISOPHON, f0)
 	return x - min(x)
 
-def create_isocurve(f0):
-	"""Create a C array with the equal loudness contour for the frequencies in
-	f0. The minimum value will be zero."""
-	return isoarray.format(curve = list2carray(reversed(normiso(f0))))
+def create_isotable(f0):
+	"""Create a C array with the weights (level minus loudness level) of tones
+	of each level, for the bands of each semitone in f0, highest first. They
+	are offset like normiso, so the 70 phon contour gets the same weights."""
+	cols = f0[-1] * 2**(-np.arange(0, len(f0) + 1, FXST) / (12.0*FXST))
+	lo = iso226(ISO_PHONS[0], cols)
+	hi = iso226(ISO_PHONS[-1], cols)
+	levels = np.arange(np.floor(min(lo)), np.ceil(max(hi)) + 1)
+
+	w = levels[:, np.newaxis] - loudness_level(levels, cols, ISO_PHONS)
+	w -= min(iso226(ISOPHON, f0)) - ISOPHON
+
+	return isotable.format(level0 = int(levels[0]), rows = len(levels),
+		cols = len(cols), table = ",\n\t".join(
+			"{%s}" % "\n\t ".join(wrap(", ".join("%.3ff" % x for x in r),
+				70)) for r in w))
 
 def allequal(l):
 	e = next(l)
@@ -345,6 +562,8 @@ def parse_args():
 						"of coefficient table.", default=AUXFILENAME)
 	parser.add_argument("-s", "--specfile", help="Override filename for the equal "
 						"loudness contour table.", default=SPECFILE)
+	parser.add_argument("-k", "--kernelfile", help="Override filename for the "
+						"specialized kernels.", default=KERNELFILE)
 
 
 	return parser.parse_args()
@@ -356,9 +575,10 @@ if __name__ == '__main__':
 		fo = open(ns.mainfile, 'w+')
 		fd = open(ns.auxfile, 'w+')
 		specf = open(ns.specfile, 'w+')
+		kf = open(ns.kernelfile, 'w+')
 	else:
 		import sys
-		fo = fd = specf = sys.stdout
+		fo = fd = specf = kf = sys.stdout
 
 	auxfile_clean = ns.auxfile.replace('.', '_').replace('/', '_')
 	fo.write(file_header % (ns.mainfile, len(FS), list2carray(FS)))
@@ -393,6 +613,9 @@ if __name__ == '__main__':
 	maxn = len(h)
 
 	define(fd, 'DFILTER_N', maxn)
+	apn = len(halfband_design(f0, frw, minfs, ATT)[-1])
+	define(fd, 'APF_N', apn)
+	define(fd, 'RTFI_N_CONFIGS', len(FS))
 
 	if ns.write:
 		fd.write(defines_footer % auxfile_clean)
@@ -400,18 +623,33 @@ if __name__ == '__main__':
 	fo.write(struct_def)
 
 	for fs in FS:
-		fo.write(create_params(f0, frw, fs, ATT, maxn))
+		fo.write(create_params(f0, frw, fs, ATT, maxn, apn))
 
+	fo.write(configs_template.format(configs = ", ".join(
+					"&rtfi_%d" % fs for fs in FS)))
 	fo.write("/* Automatically generated file ends here */\n")
 
-	specf.write(spec_header % ISOPHON)
+	kf.write(kernel_header)
+	if ns.write:
+		kf.write('#include "%s"\n' % os.path.relpath(
+			ns.auxfile, os.path.dirname(ns.kernelfile)))
+
+	for fs in FS:
+		kf.write(create_decimator(params(f0, frw, fs, ATT, maxn)[0], fs))
+
+	kf.write(create_resonator("block", 0, BLOCK))
+	kf.write(create_resonator("bottom", bottom_minindex, BLOCK))
+	kf.write(kernel_footer.format(decimators = ", ".join(
+					"decimate_%d" % fs for fs in FS)))
+
+	specf.write(spec_header % (ISO_PHONS[0], ISO_PHONS[-1], ISOPHON))
 	if ns.write:
 		specf.write('#include "%s"\n' % os.path.relpath(
 			ns.auxfile, os.path.dirname(ns.specfile)))
 
 	define(specf, 'N_HARM', N_HARM);
 	specf.write(create_hindexes(f0, N_HARM))
-	specf.write(create_isocurve(f0))
+	specf.write(create_isotable(f0))
 	specf.write(spec_footer)
 
 	if ns.plot:
@@ -0,0 +1,156 @@
+/*
+ * audiofile.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <libjc/common.h>
+#include "pcminput.h"
+#include "audiofile.h"
+
+#define WAVE_PCM 1
+#define WAVE_FLOAT 3
+#define WAVE_EXTENSIBLE 0xFFFE
+
+static uint32_t le32(const unsigned char *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static unsigned int le16(const unsigned char *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static int read_wav_header(struct audio_file *a)
+{ /* Parse the chunks up to the start of the data. The file must be positioned
+	after the RIFF header. */
+	unsigned char ck[8], fmt[40];
+	int have_fmt = 0;
+
+	while (fread(ck, sizeof(ck), 1, a->f) == 1) {
+		uint32_t size = le32(ck + 4);
+
+		if (memcmp(ck, "fmt ", 4) == 0) {
+			unsigned int tag, bits;
+			size_t n = (size < sizeof(fmt))? size : sizeof(fmt);
+
+			if (size < 16 || fread(fmt, n, 1, a->f) != 1
+			    || fseek(a->f, (long)(size - n + (size & 1)),
+								SEEK_CUR))
+				return -E_OTHER;
+
+			tag = le16(fmt);
+			if (tag == WAVE_EXTENSIBLE && n >= 26)
+				tag = le16(fmt + 24);
+			a->channels = (int)le16(fmt + 2);
+			a->sample_rate = (int)le32(fmt + 4);
+			bits = le16(fmt + 14);
+
+			if (tag == WAVE_PCM && bits == 16)
+				a->format = PCM_S16;
+			else if (tag == WAVE_PCM && bits == 32)
+				a->format = PCM_S32;
+			else if (tag == WAVE_FLOAT && bits == 32)
+				a->format = PCM_F32;
+			else
+				return -E_BADCFG;
+			have_fmt = 1;
+		} else if (memcmp(ck, "data", 4) == 0) {
+			if (!have_fmt || a->channels < 1)
+				return -E_BADCFG;
+			a->remaining = size / ((size_t)a->channels
+				* (size_t)pcm_sample_size(a->format));
+			return -E_OK;
+		} else if (fseek(a->f, (long)(size + (size & 1)), SEEK_CUR)) {
+			return -E_OTHER;
+		}
+	}
+
+	return -E_OTHER;
+}
+
+int audio_open(struct audio_file *a, const char *path, int format,
+					int channels, int sample_rate)
+{
+	unsigned char riff[12];
+	int r = -E_OK;
+
+	if ((a->f = fopen(path, "rb")) == NULL)
+		return -E_OTHER;
+
+	if (fread(riff, sizeof(riff), 1, a->f) == 1
+	    && memcmp(riff, "RIFF", 4) == 0 && memcmp(riff + 8, "WAVE", 4) == 0) {
+		r = read_wav_header(a);
+	} else {
+		a->format = format;
+		a->channels = channels;
+		a->sample_rate = sample_rate;
+		a->remaining = UINT64_MAX;
+		rewind(a->f);
+	}
+
+	if (r != -E_OK) {
+		fclose(a->f);
+		a->f = NULL;
+	}
+
+	return r;
+}
+
+int audio_read(struct audio_file *a, float *dst, int n)
+{
+	const size_t frame_size = (size_t)a->channels
+				* (size_t)pcm_sample_size(a->format);
+	size_t got, want;
+
+	if ((uint64_t)n > a->remaining)
+		n = (int)a->remaining;
+	want = (size_t)n;
+
+	if (want * frame_size > a->buf_size) {
+		void *tmp = realloc(a->buf, want * frame_size);
+
+		if (tmp == NULL)
+			return 0;
+		a->buf = tmp;
+		a->buf_size = want * frame_size;
+	}
+
+	got = fread(a->buf, frame_size, want, a->f);
+	a->remaining -= got;
+	pcm_to_mono(a->buf, a->format, a->channels, dst, (int)got);
+
+	return (int)got;
+}
+
+void audio_close(struct audio_file *a)
+{
+	if (a->f != NULL)
+		fclose(a->f);
+	a->f = NULL;
+}
+
+void audio_free(struct audio_file *a)
+{
+	free(a->buf);
+	a->buf = NULL;
+	a->buf_size = 0;
+}
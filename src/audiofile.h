@@ -0,0 +1,59 @@
+/*
+ * audiofile.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _AUDIOFILE_H_
+#define _AUDIOFILE_H_
+
+#include <stdio.h>
+#include <stdint.h>
+
+/* Read sound files for offline analysis: WAV (16 or 32 bit integer, or 32 bit
+ * float) or raw PCM with a known format (see pcminput.h). Files are read as
+ * mono.
+ *
+ * The read buffer is kept when a file is closed, so that it can be reused for
+ * the next one: a struct audio_file must start zeroed, and be released with
+ * audio_free() at the end. */
+
+struct audio_file {
+	FILE *f;
+	int format, channels, sample_rate;
+	/* frames not yet read */
+	uint64_t remaining;
+	/* raw samples, for one block */
+	void *buf;
+	size_t buf_size;
+};
+
+/* Open a file. If it is not a WAV file, it is read as raw PCM with the given
+ * format, channels and sample rate. Returns -E_OK, -E_BADCFG if the format is
+ * not supported, -E_OTHER if it cannot be read or -E_NOMEM. */
+extern int audio_open(struct audio_file *a, const char *path, int format,
+					int channels, int sample_rate);
+
+/* Read up to n frames as mono floats. Returns the number read, 0 at the end
+ * of the file. */
+extern int audio_read(struct audio_file *a, float *dst, int n);
+
+extern void audio_close(struct audio_file *a);
+extern void audio_free(struct audio_file *a);
+
+#endif /* _AUDIOFILE_H_ */
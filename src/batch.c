@@ -0,0 +1,561 @@
+/*
+ * batch.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <errno.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/stat.h>
+#include <libjc/common.h>
+#include "rtfi.h"
+#include "audiofile.h"
+#include "framewriter.h"
+#include "framereader.h"
+#include "batch.h"
+
+#define OUT_EXT ".artfi"
+
+/* Sample rates supported by the filterbank */
+static const int rates[] = {44100, 48000, 96000};
+#define N_RATES ((int)ARSIZE(rates))
+
+struct job {
+	char *in, *out;
+	off_t size;
+
+	/* results */
+	int status;
+	unsigned long frames;
+	double duration, elapsed;
+	int worker;
+};
+
+struct job_list {
+	struct job *jobs;
+	int n, cap;
+};
+
+/* Work queue of a worker. The owner takes from head, thieves from tail */
+struct deque {
+	pthread_mutex_t lock;
+	int *jobs;
+	int head, tail;
+};
+
+struct worker {
+	int id;
+	struct batch *b;
+	pthread_t thread;
+
+	/* one filterbank per sample rate, created when first needed */
+	struct rtfi_engine *engines[N_RATES];
+	float frame[ARTFI_BSIZE];
+	float block[BATCH_BLOCK];
+	struct audio_file audio;
+
+	/* file being written */
+	struct ff_writer *w;
+	unsigned long frame_no;
+	int64_t frame_ns;
+	int error;
+};
+
+struct batch {
+	const struct batch_cfg *cfg;
+	struct job_list list;
+	struct deque *queues;
+	struct worker *workers;
+};
+
+static double now_s(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* ############################ File collection ############################ */
+
+static void make_dirs(char *path, size_t skip)
+{ /* Create the directories in path, after the first skip characters. Errors
+	show up when the file is written. */
+	char *p;
+
+	for (p = path + skip; (p = strchr(p + 1, '/')) != NULL; ) {
+		*p = '\0';
+		if (mkdir(path, 0777) != 0 && errno != EEXIST)
+			PERROR("batch: cannot create %s\n", path);
+		*p = '/';
+	}
+}
+
+static int add_job(struct job_list *l, const char *path, const char *rel,
+						const char *out_dir)
+{ /* rel is used to name the output: "a/b.wav" gives "a/b.wav.artfi" under
+	out_dir. ".." components become "__", so that nothing is written
+	outside of it. */
+	struct job *j;
+	struct stat st;
+	char *p;
+
+	if (l->n == l->cap) {
+		struct job *tmp;
+
+		l->cap = l->cap? l->cap * 2 : 256;
+		if ((tmp = realloc(l->jobs, (size_t)l->cap * sizeof(*tmp)))
+								== NULL)
+			return -E_NOMEM;
+		l->jobs = tmp;
+	}
+
+	j = &l->jobs[l->n];
+	memset(j, 0, sizeof(*j));
+	j->size = (stat(path, &st) == 0)? st.st_size : 0;
+
+	while (rel[0] == '/' || (rel[0] == '.' && rel[1] == '/'))
+		rel += (rel[0] == '/')? 1 : 2;
+
+	j->in = strdup(path);
+	j->out = malloc(strlen(out_dir) + strlen(rel) + sizeof("/" OUT_EXT));
+	if (j->in == NULL || j->out == NULL) {
+		free(j->in);
+		free(j->out);
+		return -E_NOMEM;
+	}
+
+	sprintf(j->out, "%s/%s" OUT_EXT, out_dir, rel);
+	for (p = j->out + strlen(out_dir); *p != '\0'; p++)
+		if (p[0] == '/' && p[1] == '.' && p[2] == '.'
+		    && (p[3] == '/' || p[3] == '\0'))
+			p[1] = p[2] = '_';
+	make_dirs(j->out, strlen(out_dir));
+
+	l->n++;
+	return -E_OK;
+}
+
+static int is_audio(const char *name)
+{
+	const char *ext = strrchr(name, '.');
+
+	return ext != NULL && (strcasecmp(ext, ".wav") == 0
+					|| strcasecmp(ext, ".raw") == 0);
+}
+
+static int scan_dir(struct job_list *l, const char *root, const char *rel,
+						const char *out_dir)
+{ /* Add the audio files under root/rel */
+	char *dpath;
+	DIR *d;
+	struct dirent *de;
+	int r = -E_OK;
+
+	if ((dpath = malloc(strlen(root) + strlen(rel) + 2)) == NULL)
+		return -E_NOMEM;
+	sprintf(dpath, rel[0]? "%s/%s" : "%s", root, rel);
+
+	if ((d = opendir(dpath)) == NULL) {
+		PERROR("batch: cannot read %s\n", dpath);
+		free(dpath);
+		return -E_OTHER;
+	}
+
+	while (r == -E_OK && (de = readdir(d)) != NULL) {
+		char *sub, *full;
+		struct stat st;
+
+		if (de->d_name[0] == '.')
+			continue;
+
+		sub = malloc(strlen(rel) + strlen(de->d_name) + 2);
+		full = malloc(strlen(dpath) + strlen(de->d_name) + 2);
+		if (sub == NULL || full == NULL) {
+			r = -E_NOMEM;
+		} else {
+			sprintf(sub, "%s%s%s", rel, rel[0]? "/" : "",
+								de->d_name);
+			sprintf(full, "%s/%s", dpath, de->d_name);
+
+			if (stat(full, &st) != 0)
+				PERROR("batch: cannot read %s\n", full);
+			else if (S_ISDIR(st.st_mode))
+				r = scan_dir(l, root, sub, out_dir);
+			else if (S_ISREG(st.st_mode) && is_audio(de->d_name))
+				r = add_job(l, full, sub, out_dir);
+		}
+		free(sub);
+		free(full);
+	}
+
+	closedir(d);
+	free(dpath);
+	return r;
+}
+
+static int read_list(struct job_list *l, const char *path,
+						const char *out_dir)
+{ /* One file per line */
+	FILE *f = strcmp(path, "-")? fopen(path, "r") : stdin;
+	char line[4096];
+	int r = -E_OK;
+
+	if (f == NULL) {
+		PERROR("batch: cannot read %s\n", path);
+		return -E_OTHER;
+	}
+
+	while (r == -E_OK && fgets(line, sizeof(line), f) != NULL) {
+		line[strcspn(line, "\r\n")] = '\0';
+		if (line[0] != '\0')
+			r = add_job(l, line, line, out_dir);
+	}
+
+	if (f != stdin)
+		fclose(f);
+	return r;
+}
+
+static int by_out(const void *a, const void *b)
+{
+	return strcmp(((const struct job *)a)->out,
+					((const struct job *)b)->out);
+}
+
+static int check_names(struct job_list *l)
+{ /* Two inputs must not write the same output. Sorts the jobs by name. */
+	int i, r = -E_OK;
+
+	qsort(l->jobs, (size_t)l->n, sizeof(*l->jobs), by_out);
+	for (i = 1; i < l->n; i++) {
+		if (strcmp(l->jobs[i - 1].out, l->jobs[i].out) == 0) {
+			PERROR("batch: %s and %s would both be written to %s\n",
+				l->jobs[i - 1].in, l->jobs[i].in,
+				l->jobs[i].out);
+			r = -E_BADARGS;
+		}
+	}
+
+	return r;
+}
+
+static int by_size(const void *a, const void *b)
+{ /* largest first */
+	off_t sa = ((const struct job *)a)->size;
+	off_t sb = ((const struct job *)b)->size;
+
+	return (sa < sb) - (sa > sb);
+}
+
+/* ############################## Scheduling ############################### */
+
+static int take(struct deque *q, int own)
+{ /* Take a job from the front (own queue) or the back (stealing) */
+	int j = -1;
+
+	pthread_mutex_lock(&q->lock);
+	if (q->head < q->tail)
+		j = own? q->jobs[q->head++] : q->jobs[--q->tail];
+	pthread_mutex_unlock(&q->lock);
+
+	return j;
+}
+
+static int next_job(struct worker *wk)
+{
+	const int n = wk->b->cfg->jobs;
+	int i, j;
+
+	if ((j = take(&wk->b->queues[wk->id], 1)) >= 0)
+		return j;
+
+	/* Jobs are never added, so if all queues are empty, we are done */
+	for (i = 1; i < n; i++)
+		if ((j = take(&wk->b->queues[(wk->id + i) % n], 0)) >= 0)
+			return j;
+
+	return -1;
+}
+
+/* ############################### Analysis ################################ */
+
+static float *store_frame(void *arg, float *frame)
+{
+	struct worker *wk = arg;
+	int64_t t = wk->frame_ns * (int64_t)wk->frame_no;
+
+	if (ff_writer_put(wk->w, wk->frame_no, t, frame) != -E_OK)
+		wk->error = 1;
+	wk->frame_no++;
+
+	return frame;
+}
+
+static struct rtfi_engine *get_engine(struct worker *wk, int sample_rate,
+								int *ecode)
+{
+	int i;
+
+	for (i = 0; i < N_RATES && rates[i] != sample_rate; i++)
+		;
+
+	if (i == N_RATES) {
+		*ecode = -E_BADCFG;
+		return NULL;
+	}
+
+	if (wk->engines[i] == NULL) {
+		wk->engines[i] = rtfi_engine_new(sample_rate, BATCH_BLOCK,
+				wk->frame, store_frame, wk, ecode);
+	} else {
+		rtfi_engine_reset(wk->engines[i]);
+		*ecode = -E_OK;
+	}
+
+	return wk->engines[i];
+}
+
+static int render_image(const struct job *j, const struct image_cfg *img)
+{ /* Render the recording of a job, on this thread only */
+	struct image_cfg cfg = *img;
+	struct ff_reader rd;
+	size_t len = strlen(j->out) - (sizeof(OUT_EXT) - 1);
+	char prefix[len + 1];
+	int r;
+
+	memcpy(prefix, j->out, len);
+	prefix[len] = '\0';
+	cfg.prefix = prefix;
+	cfg.jobs = 1;
+
+	if ((r = ff_open(&rd, j->out)) != -E_OK)
+		return r;
+	r = image_export(&rd, &cfg);
+	ff_close(&rd);
+
+	return r;
+}
+
+static int analyze(struct worker *wk, struct job *j)
+{
+	const struct batch_cfg *cfg = wk->b->cfg;
+	struct rtfi_engine *e;
+	unsigned long samples = 0;
+	int r, n;
+
+	r = audio_open(&wk->audio, j->in, cfg->format, cfg->channels,
+							cfg->sample_rate);
+	if (r != -E_OK)
+		return r;
+
+	if ((e = get_engine(wk, wk->audio.sample_rate, &r)) == NULL)
+		goto close_audio;
+
+	wk->frame_no = 0;
+	wk->frame_ns = (int64_t)1000000000 * rtfi_engine_hop(e)
+						/ wk->audio.sample_rate;
+	wk->error = 0;
+	wk->w = ff_writer_open(j->out, cfg->qbits, cfg->delta,
+		wk->audio.sample_rate, rtfi_engine_hop(e), 0, &r);
+	if (wk->w == NULL)
+		goto close_audio;
+
+	while ((n = audio_read(&wk->audio, wk->block, BATCH_BLOCK)) > 0) {
+		samples += (unsigned long)n;
+		/* the engine only takes full blocks */
+		if (n < BATCH_BLOCK)
+			memset(wk->block + n, 0, (size_t)(BATCH_BLOCK - n)
+						* sizeof(*wk->block));
+		rtfi_engine_run(e, wk->block, BATCH_BLOCK);
+	}
+
+	j->frames = wk->frame_no;
+	j->duration = (double)samples / wk->audio.sample_rate;
+
+	if (ff_writer_close(wk->w) != -E_OK || wk->error)
+		r = -E_OTHER;
+	else if (cfg->image != NULL)
+		r = render_image(j, cfg->image);
+
+close_audio:
+	audio_close(&wk->audio);
+	return r;
+}
+
+static void *worker_run(void *arg)
+{
+	struct worker *wk = arg;
+	int jn;
+
+	while ((jn = next_job(wk)) >= 0) {
+		struct job *j = &wk->b->list.jobs[jn];
+		double t0 = now_s();
+
+		j->status = analyze(wk, j);
+		j->elapsed = now_s() - t0;
+		j->worker = wk->id;
+
+		if (j->status != -E_OK)
+			PERROR("batch: %s failed\n", j->in);
+	}
+
+	return NULL;
+}
+
+/* ################################ Driver ################################# */
+
+static int write_manifest(const struct batch *b)
+{
+	const char *status[N_ECODES] = {
+		[E_OK] = "ok", [E_NOMEM] = "nomem", [E_BADCFG] = "unsupported",
+		[E_OTHER] = "error"
+	};
+	char *path;
+	FILE *f;
+	int i, r = -E_OK;
+
+	path = malloc(strlen(b->cfg->out_dir) + sizeof("/" BATCH_MANIFEST));
+	if (path == NULL)
+		return -E_NOMEM;
+	sprintf(path, "%s/" BATCH_MANIFEST, b->cfg->out_dir);
+
+	if ((f = fopen(path, "w")) == NULL) {
+		PERROR("batch: cannot write %s\n", path);
+		free(path);
+		return -E_OTHER;
+	}
+
+	fprintf(f, "input\toutput\tstatus\tframes\tduration_s\ttime_s\tworker\n");
+	for (i = 0; i < b->list.n; i++) {
+		const struct job *j = &b->list.jobs[i];
+		const char *st = status[-j->status];
+
+		fprintf(f, "%s\t%s\t%s\t%lu\t%.3f\t%.3f\t%d\n", j->in, j->out,
+				st? st : "error", j->frames, j->duration,
+				j->elapsed, j->worker);
+	}
+
+	if (fclose(f) != 0)
+		r = -E_OTHER;
+	free(path);
+	return r;
+}
+
+int batch_run(const char *path, const struct batch_cfg *cfg)
+{
+	struct batch b;
+	struct stat st;
+	int i, k, n_started = 0, r;
+	double t0 = now_s();
+
+	memset(&b, 0, sizeof(b));
+	b.cfg = cfg;
+
+	if (cfg->jobs < 1)
+		return -E_BADCFG;
+
+	/* it may already exist */
+	mkdir(cfg->out_dir, 0777);
+
+	if (stat(path, &st) == 0 && S_ISDIR(st.st_mode))
+		r = scan_dir(&b.list, path, "", cfg->out_dir);
+	else
+		r = read_list(&b.list, path, cfg->out_dir);
+	if (r != -E_OK || (r = check_names(&b.list)) != -E_OK)
+		goto free_jobs;
+
+	qsort(b.list.jobs, (size_t)b.list.n, sizeof(*b.list.jobs), by_size);
+
+	if (NCALLOC(b.workers, (size_t)cfg->jobs) == NULL
+	    || NCALLOC(b.queues, (size_t)cfg->jobs) == NULL) {
+		r = -E_NOMEM;
+		goto free_jobs;
+	}
+
+	for (i = 0; i < cfg->jobs; i++)
+		pthread_mutex_init(&b.queues[i].lock, NULL);
+
+	/* Deal the jobs, so that each queue is also sorted by size */
+	for (i = 0; i < cfg->jobs; i++) {
+		struct deque *q = &b.queues[i];
+
+		if (NMALLOC(q->jobs, (size_t)(b.list.n / cfg->jobs + 1))
+								== NULL) {
+			r = -E_NOMEM;
+			goto free_queues;
+		}
+	}
+	for (k = 0; k < b.list.n; k++) {
+		struct deque *q = &b.queues[k % cfg->jobs];
+
+		q->jobs[q->tail++] = k;
+	}
+
+	for (i = 0; i < cfg->jobs; i++) {
+		b.workers[i].id = i;
+		b.workers[i].b = &b;
+		if (pthread_create(&b.workers[i].thread, NULL, worker_run,
+							&b.workers[i]) != 0) {
+			r = -E_OTHER;
+			break;
+		}
+		n_started++;
+	}
+
+	/* If not all the threads started, the others take all the work */
+	for (i = 0; i < n_started; i++)
+		pthread_join(b.workers[i].thread, NULL);
+
+	if (n_started > 0) {
+		if (write_manifest(&b) != -E_OK)
+			r = -E_OTHER;
+		for (k = 0; k < b.list.n; k++)
+			if (b.list.jobs[k].status != -E_OK)
+				r = -E_OTHER;
+		PERROR("batch: %d files in %.2f s\n", b.list.n, now_s() - t0);
+	}
+
+	for (i = 0; i < cfg->jobs; i++) {
+		for (k = 0; k < N_RATES; k++)
+			rtfi_engine_free(b.workers[i].engines[k]);
+		audio_free(&b.workers[i].audio);
+	}
+
+free_queues:
+	for (i = 0; i < cfg->jobs; i++) {
+		pthread_mutex_destroy(&b.queues[i].lock);
+		free(b.queues[i].jobs);
+	}
+free_jobs:
+	for (k = 0; k < b.list.n; k++) {
+		free(b.list.jobs[k].in);
+		free(b.list.jobs[k].out);
+	}
+	free(b.list.jobs);
+	free(b.queues);
+	free(b.workers);
+	return r;
+}
@@ -0,0 +1,63 @@
+/*
+ * batch.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _BATCH_H_
+#define _BATCH_H_
+
+#include "imagefile.h"
+
+/* Offline analysis of many sound files.
+ *
+ * Each input file is analyzed into a frame file in the output directory,
+ * which mirrors the directory structure of the inputs. The files are sorted
+ * by size and dealt to the workers, largest first; each worker takes from the
+ * front of its own queue, and when it runs out, steals from the back of the
+ * others. Every worker keeps its own filterbank and buffers, which are reset
+ * (not reallocated) for each file.
+ *
+ * If an image configuration is given, each recording is also rendered (see
+ * imagefile.h), with the image prefix being the recording name without the
+ * extension. Images are rendered by the worker that made the recording.
+ *
+ * At the end, a manifest (BATCH_MANIFEST, tab separated) with one line per
+ * input is written in the output directory. */
+
+#define BATCH_MANIFEST "manifest.tsv"
+/* Input samples per block. Must be a power of two. */
+#define BATCH_BLOCK 4096
+
+struct batch_cfg {
+	const char *out_dir;
+	int jobs;
+	/* frame file options */
+	int qbits, delta;
+	/* for files that are not WAV (see audiofile.h) */
+	int format, channels, sample_rate;
+	/* NULL for no images. prefix and jobs are ignored */
+	const struct image_cfg *image;
+};
+
+/* path is a directory, which is searched recursively for .wav and .raw files,
+ * or a file with one path per line ("-" for stdin). Returns -E_OK if all the
+ * files could be analyzed. */
+extern int batch_run(const char *path, const struct batch_cfg *cfg);
+
+#endif /* _BATCH_H_ */
@@ -0,0 +1,87 @@
+/*
+ * dispatch.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+/* Choosing the kernels for the processor we run on */
+
+#include <string.h>
+#include <libjc/common.h>
+#include "kernels.h"
+
+const struct kernels *kern = &kernels_base;
+
+static int has_base(void)
+{
+	return 1;
+}
+
+#ifdef KERNELS_X86
+static int has_avx2(void)
+{
+	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+static int has_avx512(void)
+{
+	return has_avx2() && __builtin_cpu_supports("avx512f")
+		&& __builtin_cpu_supports("avx512vl")
+		&& __builtin_cpu_supports("avx512bw")
+		&& __builtin_cpu_supports("avx512dq");
+}
+#endif /* KERNELS_X86 */
+
+/* Best first */
+static const struct variant {
+	const struct kernels *k;
+	int (*supported)(void);
+} variants[] = {
+#ifdef KERNELS_X86
+	{&kernels_avx512, has_avx512},
+	{&kernels_avx2, has_avx2},
+#endif
+	{&kernels_base, has_base},
+};
+
+int kernels_select(const char *name)
+{
+	const int any = (name == NULL || strcmp(name, "auto") == 0);
+	unsigned int i;
+
+#ifdef KERNELS_X86
+	__builtin_cpu_init();
+#endif
+
+	for (i = 0; i < ARSIZE(variants); i++) {
+		const struct variant *v = &variants[i];
+
+		if (!any && strcmp(name, v->k->name) != 0)
+			continue;
+		if (!v->supported()) {
+			if (any)
+				continue;
+			return -E_BADCFG;
+		}
+
+		kern = v->k;
+		return -E_OK;
+	}
+
+	return -E_BADARGS;
+}
@@ -0,0 +1,1239 @@
+/*
+ * engine.c
+ *
+ * Copyright 2012 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+/* The filterbank: decimation chain and resonators. It has no notion of where
+ * the input comes from or where the frames go (see rtfi.c for that). */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <libjc/common.h>
+#include "../src_generated/rtfi_params.c"
+#include "engine.h"
+#include "kernels.h"
+
+#define DIVUP(a, b) (((a) + (b) - 1) / (b))
+
+#ifndef M_PI
+#define M_PI (3.14159265358979323846)
+#endif /* M_PI */
+
+typedef float sample_t;
+
+#define CB_LEN DFILTER_N
+
+/* Biquads of the equalizer: high pass and shelf */
+#define EQ_N 2
+
+/* Samples of each step kept for the decimating FIR in fixed point */
+#define Q31_HIST (DFILTER_N - 1)
+
+/* A resonator set in fixed point */
+struct q31_set {
+	int32_t ar[BLOCK], ai[BLOCK], k[BLOCK];
+	int32_t yr[RTFI_STEPS][BLOCK], yi[RTFI_STEPS][BLOCK];
+	/* truncation errors of yr, yi, fed back into the next sample */
+	int32_t er[RTFI_STEPS][BLOCK], ei[RTFI_STEPS][BLOCK];
+	/* sums over the hop so far, converted when it ends */
+	struct q31_acc acc[RTFI_STEPS];
+};
+
+/* Coefficients and state for RTFI_Q31. Each buffer holds the input of a
+ * decimation step (the output of the previous one), after the last Q31_HIST
+ * samples of the previous block, so that the FIR does not need a circular
+ * buffer. buf[RTFI_STEPS] is the output of the last step. */
+struct q31_state {
+	int32_t h[DFILTER_N / 2];
+	/* the equalizer biquads (see kernels.h) */
+	int eq_n, eq_shift[EQ_N];
+	int32_t eq_c[EQ_N][5], eq_z[EQ_N][5];
+	struct q31_set set[RTFI_MAX_SETS];
+	int32_t *buf[RTFI_STEPS + 1];
+	int32_t mem[];
+};
+
+/* A set of resonators, with the bandwidths of the configuration times width.
+ * All the sets run on the same decimated signal. */
+struct res_set {
+	float width;
+	/* a1 split in real and imaginary parts, as the kernels take it */
+	float ar[BLOCK], ai[BLOCK], k[BLOCK];
+	/* resonator outputs, real and imaginary parts */
+	float yr[RTFI_STEPS][BLOCK], yi[RTFI_STEPS][BLOCK];
+	/* sum and maximum of |y|^2 of each octave over its hop so far, and
+	 * the sum of y[n] conj(y[n-1]) */
+	float acc[RTFI_STEPS][BLOCK], max[RTFI_STEPS][BLOCK];
+	float cr[RTFI_STEPS][BLOCK], ci[RTFI_STEPS][BLOCK];
+};
+
+int rtfi_default_arith = RTFI_FLOAT;
+int rtfi_default_decimator = RTFI_FIR;
+int rtfi_default_align = RTFI_ALIGN_NONE;
+float rtfi_default_hop_ms = BLK_SIZE_MS, rtfi_default_max_hop_ms = 0;
+int rtfi_default_reducer = RTFI_MEAN;
+struct rtfi_eq rtfi_default_eq;
+
+static const char *const arith_names[RTFI_N_ARITH] = {"float", "q31"};
+static const char *const decimator_names[RTFI_N_DECIMATORS] = {"fir", "iir"};
+static const char *const align_names[RTFI_N_ALIGN] = {"none", "decimators",
+									"full"};
+static const char *const reducer_names[RTFI_N_REDUCERS] = {"mean", "max",
+							"last", "db", "freq"};
+
+/* All the state of a filterbank. The built-in coefficients are shared (read
+ * only), others are copied into "own". */
+struct rtfi_engine {
+	/* These are circular buffers used to store the last samples, in order
+	 * to compute the decimating FIR across each block */
+	sample_t last_samples[RTFI_STEPS][CB_LEN];
+	/* the cb_states are 1 + index of latest sample. That means the are
+	 * initialized to CB_LEN, or 0, as they wrap around CB_LEN */
+	int cb_states[RTFI_STEPS];
+
+	/* Working area */
+	sample_t *decbuf;
+	struct res_set set[RTFI_MAX_SETS];
+	int n_sets;
+	int block_avg_nsamples[RTFI_STEPS];
+	const struct rtfi_param *cfg;
+	/* position of cfg in rtfi_configs, -1 for "own" */
+	int config;
+	struct rtfi_param own;
+	int bufsize;
+	/* NULL for RTFI_FLOAT */
+	struct q31_state *q;
+	int decimator;
+	/* last input and output of each allpass section, for RTFI_IIR */
+	float apx[RTFI_STEPS][APF_N], apy[RTFI_STEPS][APF_N];
+
+	/* Equalizer: eq_n biquads run on the input into eqbuf, and the power
+	 * gain of each octave */
+	int eq_n;
+	float eq_c[EQ_N][5], eq_z[EQ_N][2];
+	float *eqbuf;
+	float oct_gain[RTFI_STEPS];
+
+	int align;
+	/* For alignment: the last align_len frames (a circular buffer, the
+	 * latest at align_pos) and how many frames to delay each octave */
+	float *past;
+	int align_len, align_pos;
+	float align_delay[RTFI_STEPS];
+
+	/* we use this counter in case  we have to calculate each 2^n frames,
+	 * instead of every frame. This happens if jack's buffer size is less
+	 * than 2^STEPS, the lasts steps don't produce outputs in every call to
+	 * the process callback. We don't care if frame count overflows */
+	int frame_count;
+	/* Remainig samples to be processed before completing the ARTFI block*/
+	int partial_rem;
+	/* Each ARTFI block is made by processing block_input_len samples and
+	 * averaging the outputs */
+	int block_input_len;
+	int sample_rate;
+	/* Octaves with oct_hops > 1 are reduced over that many blocks.
+	 * oct_count is the number of blocks done. */
+	int oct_hops[RTFI_STEPS], oct_count[RTFI_STEPS];
+
+	/* The planes of each set. held has the values of the last complete
+	 * hop of each octave, which are copied into every frame. ext is set
+	 * if a reducer needs more than the sum (RTFI_MAX, RTFI_FREQ). */
+	int reducers[RTFI_N_REDUCERS], n_reducers, planes, ext;
+	float held[RTFI_MAX_SETS * RTFI_MAX_PLANES][N_BANDS];
+
+	/* Output */
+	float *frame;
+	rtfi_frame_cb on_frame;
+	void *arg;
+};
+
+static inline int min(int a, int b)
+{
+	return (a < b)? a : b;
+}
+
+static inline int frame_len(const struct rtfi_engine *e)
+{
+	return e->n_sets * e->planes * N_BANDS;
+}
+
+static inline sample_t cbuf_address(sample_t *cb, int cb_state, int delay)
+{ /* DELAY MUST BE >= 1 !!!!!!!!!!!!!!!!!!*/
+	return cb[(cb_state - delay) & (CB_LEN - 1)]; /*"%" retains sign, so it
+							is not useful */
+}
+
+static inline int cbuf_copy(sample_t *cb, int cb_state, sample_t *src, int n_samples)
+{ /* Copy n_samples into the circular buffer (n_samples <= CB_LEN !!!!!)
+	The only possibilities are n_samples = DFILTER_N,
+	or nsamples = DFILTER_N/(2^n). In the latter, cb_state can only be
+	k*2^n
+   returns the new value of cb_state
+  */
+  memcpy(cb + cb_state % CB_LEN, src, (size_t)n_samples*sizeof(*cb));
+  return (cb_state + n_samples) % CB_LEN;
+}
+
+static inline sample_t choose_src(sample_t *cb, int cb_state, sample_t *src, int i)
+{ /* Get a sample either from the current block (src), or the saved block,
+	dependig on the index */
+	return (i < 0)? cbuf_address(cb, cb_state, -i) : src[i];
+}
+
+static inline int decimate(int config, const float *h, sample_t *cb,
+		int cb_state, sample_t *src, int n_samples, sample_t *dst)
+{ /* We are going to assume that the decimating filter is simmetric and has an
+	even number of coefficients. In fact, if DFILTER_N is not a power of 2,
+	expect everything to fall apart
+	n_samples is the number of INPUT samples to process
+	the number of samples produced is (n_samples+1)/2
+	At the end of the process, the last samples of SOURCE are saved*/
+	const int first_stage_l = min(DFILTER_N - 1, n_samples);
+	const int to_copy = min(DFILTER_N, n_samples);
+	int n;
+
+	/* the first outputs need the samples saved from the previous block */
+	for (n = 0; n < first_stage_l; n += 2) {
+		int i;
+		sample_t acc = 0;
+
+		for (i = 0; i < (DFILTER_N / 2); i++) {
+			acc += h[i] * (choose_src(cb, cb_state, src, n-i)
+			   + choose_src(cb, cb_state, src, (n+i) - (DFILTER_N - 1)));
+		}
+
+		dst[n/2] = acc;
+	}
+
+	if (n < n_samples && config >= 0)
+		kern->decimate_cfg[config](src, n, n_samples, dst);
+	else if (n < n_samples)
+		kern->decimate(h, src, n, n_samples, dst);
+
+	return cbuf_copy(cb, cb_state, src + n_samples - to_copy, to_copy);
+}
+
+static inline int KTH_BUFSIZE(int bs, int k)
+{ /* Minimum buffer size is 1.*/
+	int kbs = bs >> (k+1);
+	return kbs? kbs : 1;
+}
+
+static inline int decbuf_index(int jack_bufsize, int k)
+{ /* Return the offset of the first element of the section of "decbuf"
+	corresponding to step k ( 0 <= k < RTFI_STEPS )*/
+	int i, acc = 0;
+
+	for (i = 0; i < k; i++) {
+		acc += KTH_BUFSIZE(jack_bufsize, i);
+	}
+
+	return acc;
+}
+
+static inline int STEP_RUNNABLE(int bs, int step, int frame_count)
+{
+	/* 0 means do always, 1 do each 2 blocks, 2 do each 4 blocks, etc */
+	int skip_n = (step - __builtin_clz((unsigned int)bs) + 1);
+	return !(frame_count % (1 << ((skip_n <= 0) ? 0 : skip_n)));
+}
+
+static void decimate_q31(struct q31_state *q, sample_t *inb, int nframes,
+							int frame_count)
+{ /* Same as the float decimation loop in rtfi_engine_run */
+	int step;
+
+	kern->to_q31(q->buf[0] + Q31_HIST, inb, nframes);
+	if (q->eq_n > 0)
+		kern->biquads_q31((const int32_t (*)[5])q->eq_c, q->eq_shift,
+			q->eq_z, q->eq_n, q->buf[0] + Q31_HIST, nframes);
+
+	for (step = 0; step < RTFI_STEPS; step++) {
+		int n_samples_in = KTH_BUFSIZE(nframes, step-1);
+		int32_t *src = q->buf[step];
+
+		if (STEP_RUNNABLE(nframes, step, frame_count))
+			kern->decimate_q31(q->h, src + Q31_HIST, n_samples_in,
+						q->buf[step + 1] + Q31_HIST);
+
+		/* n_samples_in is 1 if the step is not runnable */
+		memmove(src, src + n_samples_in, Q31_HIST * sizeof(*src));
+
+		if (!STEP_RUNNABLE(nframes, step, frame_count))
+			break;
+	}
+}
+
+static void resonate(struct rtfi_engine *e, int s, int nframes, int pstep,
+				int lo, int iinit, int iend, int first)
+{ /* Run a set over samples iinit to iend of the decimated signal of pstep,
+	for the bands lo to BLOCK, and add up its outputs (restarting if
+	first). The maximum of |y|^2 and the sum of y[n] conj(y[n-1]) (real
+	and imaginary parts) are only computed if a reducer needs them. */
+	struct res_set *set = e->set + s;
+	struct q31_state *q = e->q;
+	sample_t *src = e->decbuf + decbuf_index(nframes, pstep);
+	float yacc[BLOCK], yext[3][BLOCK];
+	int b;
+
+	if (q != NULL) {
+		/* the sums stay in integers until the end of the hop */
+		struct q31_set *qs = q->set + s;
+
+		if (first)
+			memset(qs->acc + pstep, 0, sizeof(*qs->acc));
+		kern->resonate_q31(qs->ar, qs->ai, qs->k, qs->yr[pstep],
+			qs->yi[pstep], qs->er[pstep], qs->ei[pstep],
+			q->buf[pstep + 1] + Q31_HIST + iinit, iend - iinit,
+					lo, e->ext, qs->acc + pstep);
+		return;
+	}
+
+	if (e->ext)
+		kern->resonate_ext(set->ar, set->ai, set->k, set->yr[pstep],
+			set->yi[pstep], src + iinit, iend - iinit, lo, yacc,
+						yext[0], yext[1], yext[2]);
+	else if (lo == 0)
+		kern->resonate_block(set->ar, set->ai, set->k, set->yr[pstep],
+			set->yi[pstep], src + iinit, iend - iinit, yacc);
+	else
+		kern->resonate_bottom(set->ar, set->ai, set->k,
+			set->yr[pstep], set->yi[pstep], src + iinit,
+							iend - iinit, yacc);
+
+	for (b = lo; b < BLOCK; b++)
+		set->acc[pstep][b] = yacc[b] + (first? 0 : set->acc[pstep][b]);
+
+	for (b = lo; e->ext && b < BLOCK; b++) {
+		float *max = set->max[pstep], *cr = set->cr[pstep];
+		float *ci = set->ci[pstep];
+
+		max[b] = (first || yext[0][b] > max[b])? yext[0][b] : max[b];
+		cr[b] = yext[1][b] + (first? 0 : cr[b]);
+		ci[b] = yext[2][b] + (first? 0 : ci[b]);
+	}
+}
+
+static void q31_sums(const struct q31_acc *a, int lo, int ext,
+							float (*dst)[BLOCK])
+{ /* The sums of a hop of the fixed point resonators, in the units of the
+	float ones: |y|^2, its maximum and y[n] conj(y[n-1]) */
+	const double q30 = 1.0 / (1 << 30), q62 = q30 / ((int64_t)1 << 32);
+	int b;
+
+	for (b = lo; b < BLOCK; b++)
+		dst[0][b] = (float)((double)a->p_hi[b] * q30
+						+ (double)a->p_lo[b] * q62);
+
+	for (b = lo; ext && b < BLOCK; b++) {
+		dst[1][b] = (float)((double)a->peak[b] * q62);
+		dst[2][b] = (float)((double)a->xr_hi[b] * q30
+						+ (double)a->xr_lo[b] * q62);
+		dst[3][b] = (float)((double)a->xi_hi[b] * q30
+						+ (double)a->xi_lo[b] * q62);
+	}
+}
+
+static void reduce_octave(struct rtfi_engine *e, int s, int step)
+{ /* Compute the planes of an octave of a set at the end of its hop, into
+	held. The bands are stored highest first. */
+	const int lo = (step < RTFI_STEPS - 1)? 0 : BOTTOM_MINIDEX;
+	const int n = e->block_avg_nsamples[step];
+	const struct res_set *set = e->set + s;
+	const struct q31_set *qs = (e->q != NULL)? e->q->set + s : NULL;
+	const float *acc = set->acc[step], *max = set->max[step];
+	const float *cr = set->cr[step], *ci = set->ci[step];
+	const float q31_one = 1.0f / 2147483648.0f;
+	float qsum[4][BLOCK];
+	/* Hz per radian at the rate of the step */
+	const float hz = (float)(e->sample_rate / (2 * M_PI * (2 << step)));
+	const float g = e->oct_gain[step], ga = sqrtf(g);
+	int i, b, plane = s * e->planes;
+
+	if (qs != NULL) {
+		q31_sums(e->q->set[s].acc + step, lo, e->ext, qsum);
+		acc = qsum[0];
+		max = qsum[1];
+		cr = qsum[2];
+		ci = qsum[3];
+	}
+
+	for (i = 0; i < e->n_reducers; i++) {
+		float *dst = e->held[plane++] + step * BLOCK + BLOCK - 1;
+		float *dim;
+
+		switch (e->reducers[i]) {
+		case RTFI_MEAN:
+			for (b = lo; b < BLOCK; b++)
+				dst[-b] = acc[b] / (float)n * g;
+			break;
+		case RTFI_MAX:
+			for (b = lo; b < BLOCK; b++)
+				dst[-b] = max[b] * g;
+			break;
+		case RTFI_LAST:
+			dim = e->held[plane++] + step * BLOCK + BLOCK - 1;
+			for (b = lo; b < BLOCK; b++) {
+				dst[-b] = ga * ((qs != NULL)?
+					(float)qs->yr[step][b] * q31_one
+							: set->yr[step][b]);
+				dim[-b] = ga * ((qs != NULL)?
+					(float)qs->yi[step][b] * q31_one
+							: set->yi[step][b]);
+			}
+			break;
+		case RTFI_DB:
+			for (b = lo; b < BLOCK; b++)
+				dst[-b] = acc[b] / (float)n * g;
+			kern->db(dst - (BLOCK - 1), dst - (BLOCK - 1), BLOCK - lo,
+									10);
+			break;
+		case RTFI_FREQ:
+			for (b = lo; b < BLOCK; b++)
+				dst[-b] = atan2f(ci[b], cr[b]) * hz;
+			break;
+		}
+	}
+}
+
+static void hold_octaves(struct rtfi_engine *e)
+{ /* Put the last complete values of the octaves in the frame just
+	completed */
+	int step;
+
+	memcpy(e->frame, e->held, (size_t)frame_len(e) * sizeof(*e->frame));
+
+	for (step = 0; step < RTFI_STEPS; step++)
+		e->oct_count[step] = (e->oct_count[step] + 1)
+							% e->oct_hops[step];
+}
+
+static inline const float *past_frame(const struct rtfi_engine *e, int k)
+{ /* The frame completed k frames ago */
+	return e->past + ((e->align_pos - k + e->align_len) % e->align_len)
+								* frame_len(e);
+}
+
+static void align_frame(struct rtfi_engine *e)
+{ /* Replace the upper octaves of the frame just completed with their past
+	values, so that they have the same delay as the bottom one. */
+	const int len = frame_len(e);
+	int plane, step, i;
+
+	e->align_pos = (e->align_pos + 1) % e->align_len;
+	memcpy(e->past + e->align_pos * len, e->frame,
+					(size_t)len * sizeof(*e->frame));
+
+	for (plane = 0; plane < len; plane += N_BANDS) {
+		for (step = 0; step < RTFI_STEPS - 1; step++) {
+			const int k = (int)e->align_delay[step];
+			const float f = e->align_delay[step] - (float)k;
+			const int o = plane + step * BLOCK;
+			const float *a = past_frame(e, k) + o;
+			const float *b = past_frame(e, k + 1) + o;
+			float *dst = e->frame + o;
+
+			for (i = 0; i < BLOCK; i++)
+				dst[i] = (1 - f) * a[i] + f * b[i];
+		}
+	}
+}
+
+int rtfi_engine_run(struct rtfi_engine *e, sample_t *inb, int nframes)
+{
+	int step, pstep, processed = 0;
+
+	if (e->eq_n > 0 && e->q == NULL) {
+		kern->biquads((const float (*)[5])e->eq_c, e->eq_z, e->eq_n,
+						inb, nframes, e->eqbuf);
+		inb = e->eqbuf;
+	}
+
+	for (step = 0; e->q == NULL && step < RTFI_STEPS; step++) {
+		int n_samples_in = KTH_BUFSIZE(nframes, step-1);
+	/*	int n_samples_out = KTH_BUFSIZE(nframes, step); */
+		sample_t *src, *dst;
+
+		src = (step)? (e->decbuf + decbuf_index(nframes,step-1)): inb;
+		dst = (e->decbuf + decbuf_index(nframes,step));
+
+		if (!STEP_RUNNABLE(nframes, step, e->frame_count)) {
+			e->cb_states[step] = cbuf_copy(e->last_samples[step],
+						     e->cb_states[step], src, 1);
+			break;
+		} else if (e->decimator == RTFI_IIR) {
+			kern->decimate_iir(e->cfg->apfilter, e->apx[step],
+				e->apy[step], src, n_samples_in, dst);
+		} else {
+			e->cb_states[step] = decimate(e->config,
+				e->cfg->decfilter, e->last_samples[step],
+				e->cb_states[step], src, n_samples_in, dst);
+		}
+	}
+
+	if (e->q != NULL)
+		decimate_q31(e->q, inb, nframes, e->frame_count);
+
+	while (processed < nframes) {
+		int to_process = min(nframes - processed, e->partial_rem);
+
+		for (pstep = 0; pstep < RTFI_STEPS
+				&& STEP_RUNNABLE(nframes, pstep, e->frame_count);
+								pstep++) {
+			const int m = e->oct_hops[pstep];
+			const int first = (e->partial_rem == e->block_input_len
+						&& e->oct_count[pstep] == 0);
+			const int last = (e->partial_rem == to_process
+						&& e->oct_count[pstep] == m - 1);
+			/* the bottom octave is not complete */
+			const int lo = (pstep < RTFI_STEPS - 1)? 0
+							: BOTTOM_MINIDEX;
+			int s, iinit, iend;
+
+			iinit = DIVUP(processed, 2 << pstep);
+			iend = DIVUP(processed + to_process, 2 << pstep);
+
+			if (first)
+				e->block_avg_nsamples[pstep] = (iend - iinit);
+			else
+				e->block_avg_nsamples[pstep] += (iend - iinit);
+
+			/* rtfi_engine_set_hop makes sure that every hop has
+			 * samples of all the octaves */
+			for (s = 0; s < e->n_sets; s++) {
+				resonate(e, s, nframes, pstep, lo, iinit, iend,
+									first);
+				if (last)
+					reduce_octave(e, s, pstep);
+			}
+		}
+
+		e->partial_rem -= to_process;
+		processed += to_process;
+		if (e->partial_rem == 0) {
+			hold_octaves(e);
+			if (e->past != NULL)
+				align_frame(e);
+			e->frame = e->on_frame(e->arg, e->frame);
+			e->partial_rem = e->block_input_len;
+		}
+	}
+
+	e->frame_count++;
+	return 0;
+}
+
+static inline int decbuf_minsize(int jack_bufsize) {
+	return decbuf_index(jack_bufsize, RTFI_STEPS);
+}
+
+static int builtin_config(int sample_rate)
+{ /* Configuration id for a sample rate, or -1 */
+	int i;
+
+	for (i = 0; i < RTFI_N_CONFIGS; i++)
+		if (RTFI_SAMPLERATES[i] == sample_rate)
+			return i;
+
+	return -1;
+}
+
+static int32_t to_q31(float x)
+{
+	return (int32_t)lrint(fmin(fmax(x * 2147483648.0, -INT32_MAX),
+								INT32_MAX));
+}
+
+static void q31_coeffs(struct q31_state *q, const struct rtfi_engine *e)
+{ /* The resonator sets, from the float ones */
+	int s, i;
+
+	for (s = 0; s < e->n_sets; s++) {
+		for (i = 0; i < BLOCK; i++) {
+			q->set[s].ar[i] = to_q31(e->set[s].ar[i]);
+			q->set[s].ai[i] = to_q31(e->set[s].ai[i]);
+			q->set[s].k[i] = to_q31(e->set[s].k[i]);
+		}
+	}
+}
+
+static void q31_eq(struct q31_state *q, const struct rtfi_engine *e)
+{ /* The equalizer sections, from the float ones. Each one is scaled so
+	that its largest coefficient is below 2^29. */
+	int j, i;
+
+	for (j = 0; j < e->eq_n; j++) {
+		float m = 0;
+		int g;
+
+		for (i = 0; i < 5; i++)
+			m = fmaxf(m, fabsf(e->eq_c[j][i]));
+		frexpf(m, &g);
+		g = (g < 0)? 0 : (g > 28)? 28 : g;
+
+		q->eq_shift[j] = 29 - g;
+		for (i = 0; i < 5; i++)
+			q->eq_c[j][i] = (int32_t)lrint(ldexp(e->eq_c[j][i],
+							q->eq_shift[j]));
+	}
+	q->eq_n = e->eq_n;
+}
+
+static struct q31_state *q31_new(const struct rtfi_engine *e)
+{ /* Fixed point coefficients and buffers */
+	const int bufsize = e->bufsize;
+	struct q31_state *q;
+	size_t len = 0;
+	int i;
+
+	for (i = 0; i <= RTFI_STEPS; i++)
+		len += (size_t)(Q31_HIST
+			+ (i? KTH_BUFSIZE(bufsize, i - 1) : bufsize));
+
+	if ((q = calloc(1, sizeof(*q) + len * sizeof(*q->mem))) == NULL)
+		return NULL;
+
+	for (i = 0, len = 0; i <= RTFI_STEPS; i++) {
+		q->buf[i] = q->mem + len;
+		len += (size_t)(Q31_HIST
+			+ (i? KTH_BUFSIZE(bufsize, i - 1) : bufsize));
+	}
+
+	for (i = 0; i < DFILTER_N / 2; i++)
+		q->h[i] = to_q31(e->cfg->decfilter[i]);
+	q31_coeffs(q, e);
+	q31_eq(q, e);
+
+	return q;
+}
+
+static void set_coeffs(struct rtfi_engine *e)
+{ /* The coefficients of each set, from those of the configuration. The
+	bandwidth of a pole of radius r scales with -log(r), so it is raised
+	to the width, and the gain is scaled like 1 - r. */
+	int s, i;
+
+	for (s = 0; s < e->n_sets; s++) {
+		struct res_set *set = e->set + s;
+
+		for (i = 0; i < BLOCK; i++) {
+			const double r = cabsf(e->cfg->a1[i]);
+			const double rw = pow(r, set->width);
+
+			set->ar[i] = crealf(e->cfg->a1[i]);
+			set->ai[i] = cimagf(e->cfg->a1[i]);
+			set->k[i] = e->cfg->k[i];
+			if (set->width == 1)
+				continue;
+			set->ar[i] = (float)(set->ar[i] * (rw / r));
+			set->ai[i] = (float)(set->ai[i] * (rw / r));
+			set->k[i] = (float)(set->k[i] * ((1 - rw) / (1 - r)));
+		}
+	}
+
+	if (e->q != NULL)
+		q31_coeffs(e->q, e);
+}
+
+static int lookup(const char *name, const char *const *names, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		if (!strcmp(name, names[i]))
+			return i;
+
+	return -1;
+}
+
+int rtfi_arith(const char *name)
+{
+	return lookup(name, arith_names, RTFI_N_ARITH);
+}
+
+int rtfi_decimator(const char *name)
+{
+	return lookup(name, decimator_names, RTFI_N_DECIMATORS);
+}
+
+int rtfi_align(const char *name)
+{
+	return lookup(name, align_names, RTFI_N_ALIGN);
+}
+
+int rtfi_reducer(const char *name)
+{
+	return lookup(name, reducer_names, RTFI_N_REDUCERS);
+}
+
+static double decimator_delay(const struct rtfi_engine *e)
+{ /* Group delay at low frequencies, in samples at the input of a step */
+	double d[2] = {0, 1}; /* the even samples are one sample older */
+	int i;
+
+	if (e->decimator == RTFI_FIR)
+		return (DFILTER_N - 1) / 2.0;
+
+	/* H(1) is the mean of the branches, each with the delay of its
+	 * sections (a + z^-2)/(1 + a z^-2) */
+	for (i = 0; i < APF_N; i++) {
+		const double a = e->cfg->apfilter[i];
+
+		d[i % 2] += 2 * (1 - a) / (1 + a);
+	}
+
+	return (d[0] + d[1]) / 2;
+}
+
+static double resonator_delay(const struct rtfi_engine *e, int step)
+{ /* Mean group delay at resonance, r/(1 - r), of the bands of a step, in
+	samples at its rate */
+	const int lo = (step < RTFI_STEPS - 1)? 0 : BOTTOM_MINIDEX;
+	double acc = 0;
+	int i;
+
+	for (i = lo; i < BLOCK; i++) {
+		const double r = hypot(e->set[0].ar[i], e->set[0].ai[i]);
+
+		acc += r / (1 - r);
+	}
+
+	return acc / (BLOCK - lo);
+}
+
+static double octave_delay(const struct rtfi_engine *e, int step, int res)
+{ /* In input samples: the decimators up to this step, and the resonators
+	if res. An average over a longer hop is centered further back. */
+	double d = decimator_delay(e) * ((2 << step) - 1)
+			+ (e->oct_hops[step] - 1) * e->block_input_len / 2.0;
+
+	if (res)
+		d += resonator_delay(e, step) * (2 << step);
+
+	return d;
+}
+
+static int align_setup(struct rtfi_engine *e)
+{ /* Delay lines for the current alignment, decimator and coefficients */
+	const int res = (e->align == RTFI_ALIGN_FULL);
+	const double bottom = octave_delay(e, RTFI_STEPS - 1, res);
+	int step;
+
+	free(e->past);
+	e->past = NULL;
+
+	if (e->align == RTFI_ALIGN_NONE)
+		return -E_OK;
+
+	for (step = 0; step < RTFI_STEPS; step++)
+		e->align_delay[step] = (float)((bottom
+			- octave_delay(e, step, res)) / e->block_input_len);
+
+	/* the top octave is delayed the most */
+	e->align_len = (int)e->align_delay[0] + 2;
+	if (NCALLOC(e->past, (size_t)(e->align_len * frame_len(e))) == NULL)
+		return -E_NOMEM;
+
+	return -E_OK;
+}
+
+static void eq_section(float *c, double b0, double b1, double b2, double a0,
+							double a1, double a2)
+{
+	c[0] = (float)(b0 / a0);
+	c[1] = (float)(b1 / a0);
+	c[2] = (float)(b2 / a0);
+	c[3] = (float)(a1 / a0);
+	c[4] = (float)(a2 / a0);
+}
+
+static void eq_highpass(float *c, double f)
+{ /* Butterworth, f in cycles per sample (from the Audio EQ Cookbook) */
+	const double w = 2 * M_PI * f, cw = cos(w), al = sin(w) / sqrt(2);
+
+	eq_section(c, (1 + cw) / 2, -(1 + cw), (1 + cw) / 2, 1 + al, -2 * cw,
+								1 - al);
+}
+
+static void eq_shelf(float *c, double f, double db)
+{ /* Low shelf with a slope of 1, same source */
+	const double w = 2 * M_PI * f, cw = cos(w), A = pow(10, db / 40);
+	const double sa = 2 * sqrt(A) * sin(w) / sqrt(2);
+
+	eq_section(c, A * ((A + 1) - (A - 1) * cw + sa),
+		2 * A * ((A - 1) - (A + 1) * cw),
+		A * ((A + 1) - (A - 1) * cw - sa),
+		(A + 1) + (A - 1) * cw + sa,
+		-2 * ((A - 1) + (A + 1) * cw),
+		(A + 1) + (A - 1) * cw - sa);
+}
+
+static int eq_active(const struct rtfi_eq *eq)
+{
+	int i;
+
+	for (i = 0; i < RTFI_STEPS; i++)
+		if (eq->octave_db[i] != 0)
+			return 1;
+
+	return eq->highpass_hz != 0 || eq->shelf_hz != 0;
+}
+
+int rtfi_eq_octaves(struct rtfi_eq *eq, const char *list)
+{
+	char *end;
+	int i;
+
+	for (i = 0; i < RTFI_STEPS; i++)
+		eq->octave_db[i] = 0;
+
+	for (i = 0; *list != '\0'; i++) {
+		if (i == RTFI_STEPS)
+			return -E_BADARGS;
+		eq->octave_db[i] = strtof(list, &end);
+		if (end == list || (*end != ',' && *end != '\0'))
+			return -E_BADARGS;
+		list = end + (*end == ',');
+	}
+
+	return -E_OK;
+}
+
+int rtfi_engine_set_eq(struct rtfi_engine *e, const struct rtfi_eq *eq)
+{
+	const double fs = e->sample_rate;
+	int i;
+
+	if (!(eq->highpass_hz >= 0 && eq->highpass_hz < fs / 2)
+	    || !(eq->shelf_hz >= 0 && eq->shelf_hz < fs / 2)) {
+		PERROR("The equalizer frequencies must be below half the "
+							"sample rate\n");
+		return -E_BADARGS;
+	}
+
+	if ((eq->highpass_hz > 0 || eq->shelf_hz > 0) && e->eqbuf == NULL
+	    && NMALLOC(e->eqbuf, (size_t)e->bufsize) == NULL)
+		return -E_NOMEM;
+
+	e->eq_n = 0;
+	if (eq->highpass_hz > 0)
+		eq_highpass(e->eq_c[e->eq_n++], eq->highpass_hz / fs);
+	if (eq->shelf_hz > 0 && eq->shelf_db != 0)
+		eq_shelf(e->eq_c[e->eq_n++], eq->shelf_hz / fs, eq->shelf_db);
+	if (e->q != NULL)
+		q31_eq(e->q, e);
+
+	for (i = 0; i < RTFI_STEPS; i++)
+		e->oct_gain[i] = (float)pow(10, eq->octave_db[i] / 10);
+
+	rtfi_engine_reset(e);
+
+	return -E_OK;
+}
+
+int rtfi_engine_set_align(struct rtfi_engine *e, int align)
+{
+	int r;
+
+	if (align < 0 || align >= RTFI_N_ALIGN)
+		return -E_BADARGS;
+
+	e->align = align;
+	if ((r = align_setup(e)) != -E_OK)
+		e->align = RTFI_ALIGN_NONE;
+	rtfi_engine_reset(e);
+
+	return r;
+}
+
+int rtfi_engine_set_reducers(struct rtfi_engine *e, const int *list, int n,
+								float *frame)
+{
+	int i, j, r, planes = 0;
+
+	if (n < 1 || n > RTFI_N_REDUCERS)
+		return -E_BADARGS;
+
+	for (i = 0; i < n; i++) {
+		if (list[i] < 0 || list[i] >= RTFI_N_REDUCERS)
+			return -E_BADARGS;
+		for (j = 0; j < i; j++)
+			if (list[j] == list[i])
+				return -E_BADARGS;
+		planes += (list[i] == RTFI_LAST)? 2 : 1;
+	}
+
+	memcpy(e->reducers, list, (size_t)n * sizeof(*list));
+	e->n_reducers = n;
+	e->planes = planes;
+	e->ext = 0;
+	for (i = 0; i < n; i++)
+		e->ext |= (list[i] == RTFI_MAX || list[i] == RTFI_FREQ);
+	e->frame = frame;
+
+	/* the frames in the delay lines are longer or shorter */
+	if ((r = align_setup(e)) != -E_OK)
+		e->align = RTFI_ALIGN_NONE;
+	rtfi_engine_reset(e);
+
+	return r;
+}
+
+int rtfi_engine_set_widths(struct rtfi_engine *e, const float *widths, int n,
+								float *frame)
+{
+	int s, r;
+
+	if (n < 1 || n > RTFI_MAX_SETS)
+		return -E_BADARGS;
+
+	for (s = 0; s < n; s++)
+		if (!(widths[s] > 0 && widths[s] <= RTFI_MAX_WIDTH))
+			return -E_BADARGS;
+
+	for (s = 0; s < n; s++)
+		e->set[s].width = widths[s];
+	e->n_sets = n;
+	set_coeffs(e);
+	e->frame = frame;
+
+	/* the resonator delays and the length of the frames changed */
+	if ((r = align_setup(e)) != -E_OK)
+		e->align = RTFI_ALIGN_NONE;
+	rtfi_engine_reset(e);
+
+	return r;
+}
+
+int rtfi_engine_frame_len(const struct rtfi_engine *e)
+{
+	return frame_len(e);
+}
+
+int rtfi_engine_set_hop(struct rtfi_engine *e, float hop_ms,
+							float max_hop_ms)
+{
+	const int hop = (int)ceilf((float)(((float)e->sample_rate * hop_ms)
+								/ 1000.0));
+	int step, k, kmax, r;
+
+	if (!(hop_ms > 0 && hop_ms <= 1000) || hop < RTFI_MIN_HOP) {
+		PERROR("The hop must be at least %d samples, and at most 1000 "
+						"ms\n", RTFI_MIN_HOP);
+		return -E_BADARGS;
+	}
+
+	/* the longest average, in frames, rounded down to a power of two */
+	k = (max_hop_ms > hop_ms)? (int)(max_hop_ms / hop_ms + 0.5f) : 1;
+	for (kmax = 1; kmax * 2 <= k; kmax *= 2)
+		;
+
+	e->block_input_len = hop;
+	for (step = 0; step < RTFI_STEPS; step++) {
+		int m = min(1 << step, kmax);
+
+		/* at least one sample of the step */
+		while (m * hop < (2 << step))
+			m *= 2;
+		e->oct_hops[step] = m;
+	}
+
+	/* the delays in frames changed */
+	if ((r = align_setup(e)) != -E_OK)
+		e->align = RTFI_ALIGN_NONE;
+	rtfi_engine_reset(e);
+
+	return r;
+}
+
+double rtfi_engine_delay(const struct rtfi_engine *e, int step)
+{
+	double d = octave_delay(e, step, 1);
+
+	if (e->past != NULL)
+		d += e->align_delay[step] * (float)e->block_input_len;
+
+	return d;
+}
+
+int rtfi_engine_set_arith(struct rtfi_engine *e, int arith)
+{
+	struct q31_state *q = NULL;
+
+	if (arith < 0 || arith >= RTFI_N_ARITH)
+		return -E_BADARGS;
+
+	if (arith == RTFI_Q31 && e->decimator == RTFI_IIR) {
+		PERROR("The IIR decimator is not available in fixed point\n");
+		return -E_BADCFG;
+	}
+
+	if (arith == RTFI_Q31 && (q = q31_new(e)) == NULL)
+		return -E_NOMEM;
+
+	free(e->q);
+	e->q = q;
+	rtfi_engine_reset(e);
+
+	return -E_OK;
+}
+
+int rtfi_engine_set_decimator(struct rtfi_engine *e, int decimator)
+{
+	int r;
+
+	if (decimator < 0 || decimator >= RTFI_N_DECIMATORS)
+		return -E_BADARGS;
+
+	if (decimator == RTFI_IIR) {
+		if (e->config < 0) {
+			PERROR("The IIR decimator needs the built-in "
+							"coefficients\n");
+			return -E_BADCFG;
+		}
+		if (e->q != NULL) {
+			PERROR("The IIR decimator is not available in fixed "
+								"point\n");
+			return -E_BADCFG;
+		}
+		/* otherwise the last steps get an odd number of samples */
+		if (e->bufsize < (1 << RTFI_STEPS)) {
+			PERROR("The IIR decimator needs blocks of at least %d "
+					"samples\n", 1 << RTFI_STEPS);
+			return -E_BADCFG;
+		}
+	}
+
+	e->decimator = decimator;
+	/* the delays changed */
+	if ((r = align_setup(e)) != -E_OK)
+		e->align = RTFI_ALIGN_NONE;
+	rtfi_engine_reset(e);
+
+	return r;
+}
+
+static struct rtfi_engine *engine_new(int config,
+			int sample_rate, int bufsize, float *frame,
+			rtfi_frame_cb on_frame, void *arg, int *ecode)
+{ /* If config is -1, the coefficients are left for the caller to fill in
+	e->own */
+	struct rtfi_engine *e = NULL;
+	int dbs, i, r = -E_OK;
+
+	if (__CALLOC(e) == NULL) {
+		r = -E_NOMEM;
+		goto disaster;
+	}
+
+	dbs = decbuf_minsize(bufsize);
+	if (NMALLOC(e->decbuf, (size_t)dbs) == NULL) {
+		free(e);
+		e = NULL;
+		r = -E_NOMEM;
+		goto disaster;
+	}
+
+	e->config = config;
+	e->cfg = (config >= 0)? rtfi_configs[config] : &e->own;
+	e->set[0].width = 1;
+	e->n_sets = 1;
+	set_coeffs(e);
+	e->bufsize = bufsize;
+	e->sample_rate = sample_rate;
+	e->block_input_len = (int)ceilf((float)((sample_rate * BLK_SIZE_MS)
+								/ 1000.0));
+	for (i = 0; i < RTFI_STEPS; i++) {
+		e->oct_hops[i] = 1;
+		e->oct_gain[i] = 1;
+	}
+	e->reducers[0] = RTFI_MEAN;
+	e->n_reducers = e->planes = 1;
+	e->frame = frame;
+	e->on_frame = on_frame;
+	e->arg = arg;
+	rtfi_engine_reset(e);
+
+disaster:
+	if (ecode != NULL)
+		*ecode = r;
+	return e;
+}
+
+static struct rtfi_engine *set_defaults(struct rtfi_engine *e, int *ecode)
+{ /* Last step of creating an engine */
+	int r = -E_OK;
+
+	if (e == NULL)
+		return e;
+
+	if (rtfi_default_hop_ms != BLK_SIZE_MS || rtfi_default_max_hop_ms > 0)
+		r = rtfi_engine_set_hop(e, rtfi_default_hop_ms,
+						rtfi_default_max_hop_ms);
+	if (r == -E_OK && rtfi_default_decimator != RTFI_FIR)
+		r = rtfi_engine_set_decimator(e, rtfi_default_decimator);
+	if (r == -E_OK && rtfi_default_arith != RTFI_FLOAT)
+		r = rtfi_engine_set_arith(e, rtfi_default_arith);
+	if (r == -E_OK && rtfi_default_align != RTFI_ALIGN_NONE)
+		r = rtfi_engine_set_align(e, rtfi_default_align);
+	if (r == -E_OK && eq_active(&rtfi_default_eq))
+		r = rtfi_engine_set_eq(e, &rtfi_default_eq);
+	/* the caller's frame only has room for one plane */
+	if (r == -E_OK && rtfi_default_reducer == RTFI_LAST)
+		r = -E_BADARGS;
+	else if (r == -E_OK && rtfi_default_reducer != RTFI_MEAN)
+		r = rtfi_engine_set_reducers(e, &rtfi_default_reducer, 1,
+								e->frame);
+
+	if (r != -E_OK) {
+		rtfi_engine_free(e);
+		e = NULL;
+		if (ecode != NULL)
+			*ecode = r;
+	}
+
+	return e;
+}
+
+struct rtfi_engine *rtfi_engine_new(int sample_rate, int bufsize, float *frame,
+			rtfi_frame_cb on_frame, void *arg, int *ecode)
+{
+	int config = builtin_config(sample_rate);
+
+	if (config < 0) {
+		PERROR("Unsupported sample rate: %d\n", sample_rate);
+		if (ecode != NULL)
+			*ecode = -E_BADCFG;
+		return NULL;
+	}
+
+	return set_defaults(engine_new(config, sample_rate, bufsize, frame,
+					on_frame, arg, ecode), ecode);
+}
+
+struct rtfi_engine *rtfi_engine_new_coeffs(int sample_rate,
+		const float *decfilter, const float *a1, const float *k,
+		int bufsize, float *frame, rtfi_frame_cb on_frame, void *arg,
+		int *ecode)
+{
+	struct rtfi_engine *e;
+
+	e = engine_new(-1, sample_rate, bufsize, frame, on_frame, arg, ecode);
+	if (e != NULL) {
+		memcpy(e->own.decfilter, decfilter, sizeof(e->own.decfilter));
+		/* a complex float has the layout of float[2] */
+		memcpy(e->own.a1, a1, sizeof(e->own.a1));
+		memcpy(e->own.k, k, sizeof(e->own.k));
+		set_coeffs(e);
+	}
+
+	return set_defaults(e, ecode);
+}
+
+int rtfi_builtin_coeffs(int sample_rate, const float **decfilter,
+					const float **a1, const float **k)
+{
+	const int config = builtin_config(sample_rate);
+	const struct rtfi_param *cfg;
+
+	if (config < 0)
+		return -E_BADCFG;
+
+	cfg = rtfi_configs[config];
+
+	*decfilter = cfg->decfilter;
+	*a1 = (const float *)cfg->a1;
+	*k = cfg->k;
+
+	return -E_OK;
+}
+
+void rtfi_engine_set_frame(struct rtfi_engine *e, float *frame)
+{
+	e->frame = frame;
+}
+
+void rtfi_engine_reset(struct rtfi_engine *e)
+{
+	int i;
+
+	memset(e->last_samples, 0, sizeof(e->last_samples));
+	memset(e->cb_states, 0, sizeof(e->cb_states));
+	for (i = 0; i < RTFI_MAX_SETS; i++) {
+		struct res_set *set = e->set + i;
+
+		memset(set->yr, 0, sizeof(set->yr));
+		memset(set->yi, 0, sizeof(set->yi));
+		memset(set->acc, 0, sizeof(set->acc));
+		memset(set->max, 0, sizeof(set->max));
+		memset(set->cr, 0, sizeof(set->cr));
+		memset(set->ci, 0, sizeof(set->ci));
+	}
+	memset(e->apx, 0, sizeof(e->apx));
+	memset(e->apy, 0, sizeof(e->apy));
+	memset(e->eq_z, 0, sizeof(e->eq_z));
+	if (e->past != NULL)
+		memset(e->past, 0, (size_t)(e->align_len * frame_len(e))
+							* sizeof(*e->past));
+	e->align_pos = 0;
+	memset(e->oct_count, 0, sizeof(e->oct_count));
+	memset(e->held, 0, sizeof(e->held));
+	if (e->q != NULL) {
+		struct q31_state *q = e->q;
+
+		for (i = 0; i < RTFI_MAX_SETS; i++) {
+			struct q31_set *qs = q->set + i;
+
+			memset(qs->yr, 0, sizeof(qs->yr));
+			memset(qs->yi, 0, sizeof(qs->yi));
+			memset(qs->er, 0, sizeof(qs->er));
+			memset(qs->ei, 0, sizeof(qs->ei));
+		}
+		for (i = 0; i <= RTFI_STEPS; i++)
+			memset(q->buf[i], 0, Q31_HIST * sizeof(*q->buf[i]));
+		memset(q->eq_z, 0, sizeof(q->eq_z));
+	}
+	e->frame_count = 0;
+	e->partial_rem = e->block_input_len;
+}
+
+void rtfi_engine_free(struct rtfi_engine *e)
+{
+	if (e != NULL) {
+		free(e->decbuf);
+		free(e->q);
+		free(e->past);
+		free(e->eqbuf);
+	}
+	free(e);
+}
+
+int rtfi_engine_hop(const struct rtfi_engine *e)
+{
+	return e->block_input_len;
+}
+
+int rtfi_engine_octave_hop(const struct rtfi_engine *e, int step)
+{
+	return e->oct_hops[step];
+}
+
@@ -0,0 +1,233 @@
+/*
+ * engine.h
+ *
+ * Copyright 2012 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _ENGINE_H_
+#define _ENGINE_H_
+
+#include "../src_generated/rtfi_defines.h"
+
+/* Independent filterbanks, e.g. for analyzing files in several threads.
+ *
+ * Frames are accumulated in a buffer given by the caller. When one is
+ * complete, on_frame is called with it and must return the buffer for the
+ * next one (which may be the same). Input must be given in blocks of bufsize
+ * samples, a power of two. The live engine is one of these.
+ *
+ * This does not depend on JACK or on the rest of the program, so it can be
+ * built on its own (e.g. for the Python module). */
+
+/* default hop */
+#define BLK_SIZE_MS 10
+/* shortest hop, in samples */
+#define RTFI_MIN_HOP 32
+
+typedef float *(*rtfi_frame_cb)(void *arg, float *frame);
+
+struct rtfi_engine;
+
+/* Arithmetic of the decimators and resonators. RTFI_Q31 uses 32 bit fixed
+ * point samples and coefficients with 64 bit accumulators, as an integer-only
+ * target would. The input saturates at full scale; below that its frames are
+ * within 0.05 dB of the float ones for bands above -120 dB (and within 0.5 dB
+ * down to -150 dB). */
+enum RTFI_ARITH {RTFI_FLOAT, RTFI_Q31, RTFI_N_ARITH};
+
+/* Returns a RTFI_ARITH, or -1 if the name ("float", "q31") is not known */
+extern int rtfi_arith(const char *name);
+
+/* Arithmetic of the engines created from now on. Programs set it from the
+ * command line, before starting the analysis. */
+extern int rtfi_default_arith;
+
+/* Decimating filter of the octave steps. RTFI_FIR is the linear phase FIR.
+ * RTFI_IIR is a half-band of allpass sections with the same pass band and
+ * attenuation, a quarter of the multiplies and a sixth of the delay, but not
+ * linear phase. It only works with the built-in coefficients, in float, and
+ * with blocks of at least 2^RTFI_STEPS samples. */
+enum RTFI_DECIMATOR {RTFI_FIR, RTFI_IIR, RTFI_N_DECIMATORS};
+
+/* Returns a RTFI_DECIMATOR, or -1 if the name ("fir", "iir") is not known */
+extern int rtfi_decimator(const char *name);
+
+/* Decimator of the engines created from now on, like rtfi_default_arith */
+extern int rtfi_default_decimator;
+
+/* Each octave is delayed by the decimators before it and by its resonators,
+ * so the low octaves lag the high ones. With RTFI_ALIGN_DECIMATORS the high
+ * octaves of each frame are delayed to match the decimation delay of the
+ * bottom one; with RTFI_ALIGN_FULL also the (mean) resonator delay of each
+ * octave, which is much longer: more than two seconds for the bottom one.
+ * The delays are fractions of a frame, interpolated between frames. */
+enum RTFI_ALIGN {RTFI_ALIGN_NONE, RTFI_ALIGN_DECIMATORS, RTFI_ALIGN_FULL,
+							RTFI_N_ALIGN};
+
+/* Returns a RTFI_ALIGN, or -1 if the name ("none", "decimators", "full")
+ * is not known */
+extern int rtfi_align(const char *name);
+
+/* Alignment of the engines created from now on, like rtfi_default_arith */
+extern int rtfi_default_align;
+
+/* Hop of the engines created from now on (see rtfi_engine_set_hop), in ms.
+ * By default BLK_SIZE_MS and 0. */
+extern float rtfi_default_hop_ms, rtfi_default_max_hop_ms;
+
+/* What the frames hold, computed in the resonator loop. Each reducer gives
+ * one plane of N_BANDS values (RTFI_LAST gives two) and the frame has the
+ * planes of all the reducers of the engine, one after the other:
+ *	RTFI_MEAN: mean of |y|^2 over the hop (the default)
+ *	RTFI_MAX: maximum of |y|^2 over the hop
+ *	RTFI_LAST: y at the end of the hop, real and imaginary planes
+ *	RTFI_DB: 10 log10 of the mean
+ *	RTFI_FREQ: instantaneous frequency in Hz, from the phase advance of y
+ *		   between samples, weighted by the power (0 if there is none)
+ * Octaves with longer hops (see rtfi_engine_set_hop) reduce over those. */
+enum RTFI_REDUCER {RTFI_MEAN, RTFI_MAX, RTFI_LAST, RTFI_DB, RTFI_FREQ,
+							RTFI_N_REDUCERS};
+
+/* Planes of a frame with all the reducers */
+#define RTFI_MAX_PLANES (RTFI_N_REDUCERS + 1)
+
+/* Returns a RTFI_REDUCER, or -1 if the name ("mean", "max", "last", "db",
+ * "freq") is not known */
+extern int rtfi_reducer(const char *name);
+
+/* Reducer of the engines created from now on, like rtfi_default_arith. The
+ * programs only take the single plane ones. */
+extern int rtfi_default_reducer;
+
+/* Equalizer of the input, instead of an external one (low frequencies and
+ * percussion make the notes harder to see). The high pass and the shelf are
+ * biquads run on the input (in Q31 with RTFI_Q31, where a boost saturates at
+ * full scale); the octave gains scale the outputs of each octave, at no cost.
+ * All zero is no equalization.
+ */
+struct rtfi_eq {
+	/* cutoff of a second order Butterworth high pass, 0 for none */
+	float highpass_hz;
+	/* low shelf: gain in dB below shelf_hz (negative to cut) */
+	float shelf_hz, shelf_db;
+	/* power gain of each octave in dB, the top one first */
+	float octave_db[RTFI_STEPS];
+};
+
+/* Equalizer of the engines created from now on, like rtfi_default_arith */
+extern struct rtfi_eq rtfi_default_eq;
+
+/* Parse a list of up to RTFI_STEPS comma separated gains in dB into
+ * eq->octave_db (the rest are 0). Returns -E_OK or -E_BADARGS. */
+extern int rtfi_eq_octaves(struct rtfi_eq *eq, const char *list);
+
+/* Returns NULL on failure, error code in *ecode */
+extern struct rtfi_engine *rtfi_engine_new(int sample_rate, int bufsize,
+		float *frame, rtfi_frame_cb on_frame, void *arg, int *ecode);
+
+/* Same, but with other coefficients than the built-in ones, as generated by
+ * scripts/rtfi.py: the first DFILTER_N/2 taps of the (symmetric) decimation
+ * filter, and the BLOCK gains k and poles a1 of the resonators of the top
+ * octave, highest last. a1 has BLOCK pairs of floats (real, imaginary). The
+ * coefficients are copied. */
+extern struct rtfi_engine *rtfi_engine_new_coeffs(int sample_rate,
+		const float *decfilter, const float *a1, const float *k,
+		int bufsize, float *frame, rtfi_frame_cb on_frame, void *arg,
+		int *ecode);
+
+/* Built-in coefficients for a sample rate, in the same layout. Returns -E_OK
+ * or -E_BADCFG if the rate is not supported. */
+extern int rtfi_builtin_coeffs(int sample_rate, const float **decfilter,
+					const float **a1, const float **k);
+
+/* Change the arithmetic of an engine. This resets it. Returns -E_OK,
+ * -E_NOMEM, -E_BADARGS or -E_BADCFG (Q31 with the IIR decimator). */
+extern int rtfi_engine_set_arith(struct rtfi_engine *e, int arith);
+
+/* Change the decimator of an engine. This resets it. Returns -E_OK,
+ * -E_NOMEM, -E_BADARGS, or -E_BADCFG if the engine cannot use it (see
+ * above). */
+extern int rtfi_engine_set_decimator(struct rtfi_engine *e, int decimator);
+
+/* Change the equalizer of an engine. This resets it. Returns -E_OK,
+ * -E_NOMEM or -E_BADARGS (a frequency not below half the sample rate). */
+extern int rtfi_engine_set_eq(struct rtfi_engine *e, const struct rtfi_eq *eq);
+
+/* Change the alignment of an engine. This resets it. Returns -E_OK,
+ * -E_NOMEM or -E_BADARGS. */
+extern int rtfi_engine_set_align(struct rtfi_engine *e, int align);
+
+/* Change the time between frames, hop_ms (rounded up to whole samples, and
+ * at least RTFI_MIN_HOP of them).
+ * If max_hop_ms is longer, the octaves below the top one are averaged over
+ * 2, 4, ... frames, twice as many as the one above, up to the largest power
+ * of two that fits in max_hop_ms (to the nearest frame), and keep their value
+ * in the frames in between; the top octaves are updated in every frame. An
+ * octave is never averaged over less than one of its (decimated) samples,
+ * which may take a longer power of two. This resets the engine. Returns
+ * -E_OK, -E_NOMEM or -E_BADARGS. */
+extern int rtfi_engine_set_hop(struct rtfi_engine *e, float hop_ms,
+							float max_hop_ms);
+
+/* Change the reducers of an engine to the n (at least one, none repeated)
+ * in the list, in that order. frame is the buffer for the next frame, which
+ * must hold rtfi_engine_frame_len floats. This resets the engine. Returns
+ * -E_OK, -E_NOMEM or -E_BADARGS. */
+extern int rtfi_engine_set_reducers(struct rtfi_engine *e, const int *list,
+							int n, float *frame);
+
+/* Most resonator sets of an engine, and widest bandwidth of a set */
+#define RTFI_MAX_SETS 4
+#define RTFI_MAX_WIDTH 16
+
+/* Run n sets of resonators on the same decimated signal, with the bandwidths
+ * of the coefficients times widths[i] (more than 0, up to RTFI_MAX_WIDTH): the
+ * narrow ones resolve the frequency better and the wide ones follow faster
+ * changes. By default there is one set of width 1. The frame has the planes of
+ * the reducers for each set, the first set first. frame is as in
+ * rtfi_engine_set_reducers. The full alignment uses the delay of the first
+ * set. This resets the engine. Returns -E_OK, -E_NOMEM or -E_BADARGS. */
+extern int rtfi_engine_set_widths(struct rtfi_engine *e, const float *widths,
+							int n, float *frame);
+
+/* floats in each frame: N_BANDS times the number of planes of all the sets */
+extern int rtfi_engine_frame_len(const struct rtfi_engine *e);
+
+/* Clear the state, to start with a new signal */
+extern void rtfi_engine_reset(struct rtfi_engine *e);
+extern void rtfi_engine_free(struct rtfi_engine *e);
+extern int rtfi_engine_run(struct rtfi_engine *e, float *inb, int nframes);
+
+/* Give the frame in progress in another buffer. Frames are only written
+ * when they are complete, so the contents of the old one are not copied. */
+extern void rtfi_engine_set_frame(struct rtfi_engine *e, float *frame);
+
+/* input samples per frame */
+extern int rtfi_engine_hop(const struct rtfi_engine *e);
+
+/* How many frames the bands of a step (0 is the top octave) are averaged
+ * over */
+extern int rtfi_engine_octave_hop(const struct rtfi_engine *e, int step);
+
+/* Delay of the bands of a step (0 is the top octave) in input samples, from
+ * the decimators, the resonators (at the middle of the octave) and the
+ * alignment. A frame covers the hop samples that end this long before it is
+ * given to on_frame. */
+extern double rtfi_engine_delay(const struct rtfi_engine *e, int step);
+
+#endif /* _ENGINE_H_ */
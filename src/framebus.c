@@ -0,0 +1,226 @@
+/*
+ * framebus.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <semaphore.h>
+#include <libjc/common.h>
+#include "rtfi.h"
+#include "framebus.h"
+
+#define ALIGN_UP(x, a) ((((x) + (a) - 1) / (a)) * (a))
+
+static inline struct fb_slot *get_slot(const struct framebus *fb, uint64_t n)
+{
+	return (struct fb_slot *)(fb->slots
+			+ (size_t)(n % fb->hdr->n_slots) * fb->hdr->slot_size);
+}
+
+static int map(struct framebus *fb, int fd, int writable)
+{
+	void *m = mmap(NULL, fb->size, writable? PROT_READ|PROT_WRITE : PROT_READ,
+							MAP_SHARED, fd, 0);
+
+	if (m == MAP_FAILED)
+		return -E_OTHER;
+
+	fb->hdr = m;
+	fb->slots = (unsigned char *)m
+			+ ALIGN_UP(sizeof(struct fb_header), FB_ALIGN);
+	return -E_OK;
+}
+
+int framebus_create(struct framebus *fb, const char *name, int sample_rate,
+								int hop)
+{
+	size_t slot_size = ALIGN_UP(sizeof(struct fb_slot)
+				+ ARTFI_BSIZE * sizeof(float), FB_ALIGN);
+	int fd, r = -E_OK;
+
+	fb->writer = 1;
+	fb->size = ALIGN_UP(sizeof(struct fb_header), FB_ALIGN)
+						+ FB_SLOTS * slot_size;
+
+	if ((fb->name = strdup(name)) == NULL) {
+		r = -E_NOMEM;
+		goto disaster;
+	}
+
+	/* Never take over an existing object: it may belong to a running
+	 * instance, whose readers would silently switch to our frames. */
+	if ((fd = shm_open(name, O_RDWR|O_CREAT|O_EXCL, 0644)) < 0) {
+		if (errno == EEXIST)
+			PERROR("framebus: %s already exists. If no other "
+				"instance is using it, remove /dev/shm%s\n",
+				name, name);
+		else
+			PERROR("framebus: cannot create %s\n", name);
+		r = -E_OTHER;
+		goto free_name;
+	}
+
+	if (ftruncate(fd, (off_t)fb->size) != 0 || map(fb, fd, 1) != -E_OK) {
+		r = -E_OTHER;
+		goto unlink;
+	}
+	close(fd);
+
+	/* Touch every page now, so the audio thread does not fault on them */
+	memset(fb->hdr, 0, fb->size);
+	fb->hdr->version = FB_VERSION;
+	fb->hdr->n_bands = ARTFI_BSIZE;
+	fb->hdr->n_slots = FB_SLOTS;
+	fb->hdr->slot_size = (uint32_t)slot_size;
+	fb->hdr->hop = (uint32_t)hop;
+	fb->hdr->sample_rate = (uint32_t)sample_rate;
+	/* Readers check the magic last */
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memcpy(fb->hdr->magic, FB_MAGIC, sizeof(fb->hdr->magic));
+
+	return -E_OK;
+
+unlink:
+	close(fd);
+	shm_unlink(name);
+free_name:
+	free(fb->name);
+disaster:
+	return r;
+}
+
+void framebus_push(void *fb_, const float *frame)
+{
+	struct framebus *fb = fb_;
+	uint64_t n = fb->hdr->head;
+	struct fb_slot *slot = get_slot(fb, n);
+	struct timespec ts;
+	uint32_t seq = slot->seq;
+
+	__atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	slot->frame = n;
+	slot->time_ns = ts.tv_sec * (int64_t)1000000000 + ts.tv_nsec;
+	memcpy(slot->data, frame, ARTFI_BSIZE * sizeof(float));
+
+	__atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+	__atomic_store_n(&fb->hdr->head, n + 1, __ATOMIC_RELEASE);
+}
+
+int framebus_attach(struct framebus *fb, const char *name)
+{
+	struct fb_header h;
+	struct stat st;
+	int fd, r = -E_OK;
+
+	fb->writer = 0;
+	fb->name = NULL;
+
+	if ((fd = shm_open(name, O_RDONLY, 0)) < 0 || fstat(fd, &st) != 0) {
+		PERROR("framebus: cannot open %s\n", name);
+		r = -E_OTHER;
+		goto disaster;
+	}
+
+	fb->size = (size_t)st.st_size;
+	if (fb->size < sizeof(h)) {
+		r = -E_BADCFG;
+		goto disaster;
+	}
+
+	if (map(fb, fd, 0) != -E_OK) {
+		r = -E_OTHER;
+		goto disaster;
+	}
+
+	memcpy(h.magic, (const void *)fb->hdr->magic, sizeof(h.magic));
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	memcpy(&h, fb->hdr, sizeof(h));
+
+	if (memcmp(h.magic, FB_MAGIC, sizeof(h.magic)) != 0
+	    || h.version != FB_VERSION
+	    || ALIGN_UP(sizeof(h), FB_ALIGN)
+			+ (size_t)h.n_slots * h.slot_size > fb->size) {
+		PERROR("framebus: %s is not a frame bus\n", name);
+		munmap(fb->hdr, fb->size);
+		r = -E_BADCFG;
+	}
+
+disaster:
+	if (fd >= 0)
+		close(fd);
+	return r;
+}
+
+void framebus_close(struct framebus *fb)
+{
+	munmap(fb->hdr, fb->size);
+	if (fb->writer) {
+		shm_unlink(fb->name);
+		free(fb->name);
+	}
+}
+
+uint64_t framebus_head(const struct framebus *fb)
+{
+	return __atomic_load_n(&fb->hdr->head, __ATOMIC_ACQUIRE);
+}
+
+const float *framebus_peek(const struct framebus *fb, uint64_t n,
+							uint32_t *seq)
+{
+	const struct fb_slot *slot = get_slot(fb, n);
+
+	*seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+	if ((*seq & 1) || slot->frame != n || n >= framebus_head(fb))
+		return NULL;
+
+	return slot->data;
+}
+
+int framebus_check(const struct framebus *fb, uint64_t n, uint32_t seq)
+{
+	const struct fb_slot *slot = get_slot(fb, n);
+
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	return __atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq;
+}
+
+int framebus_read(const struct framebus *fb, uint64_t n, float *data)
+{
+	const float *p;
+	uint32_t seq;
+
+	if ((p = framebus_peek(fb, n, &seq)) == NULL)
+		return -E_OTHER;
+
+	memcpy(data, p, fb->hdr->n_bands * sizeof(float));
+
+	return framebus_check(fb, n, seq)? -E_OK : -E_OTHER;
+}
@@ -0,0 +1,111 @@
+/*
+ * framebus.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _FRAMEBUS_H_
+#define _FRAMEBUS_H_
+
+#include <stdint.h>
+
+/* Publish ARTFI frames in a POSIX shared memory object, so that other local
+ * processes can read them.
+ *
+ * The object has a struct fb_header followed by n_slots slots, used as a ring:
+ * frame n goes to slot n % n_slots. Each slot has a sequence counter that is
+ * odd while the slot is being written and is incremented again when done.
+ * A reader checks the counter before and after reading the slot: if it is odd
+ * or has changed, the frame was overwritten in the meantime. The writer never
+ * waits for readers, and readers do not need any system call: they poll
+ * head (frames published so far) at the frame rate or slower.
+ *
+ * Slots hold the frame values as in rtfi_blocks (not in dB). All fields are
+ * in native byte order. */
+
+#define FB_MAGIC "ARTB"
+#define FB_VERSION 1
+/* 0.64 seconds of frames */
+#define FB_SLOTS 64
+/* Slots are aligned to cache lines */
+#define FB_ALIGN 64
+
+struct fb_header {
+	char magic[4];
+	uint32_t version;
+	uint32_t n_bands;
+	uint32_t n_slots;
+	/* bytes from the start of a slot to the start of the next one */
+	uint32_t slot_size;
+	uint32_t hop;
+	uint32_t sample_rate;
+	uint32_t reserved;
+	/* number of frames published */
+	uint64_t head;
+};
+
+struct fb_slot {
+	uint32_t seq;
+	uint32_t reserved;
+	uint64_t frame;
+	/* CLOCK_REALTIME when the frame was published, in ns */
+	int64_t time_ns;
+	int64_t reserved2;
+	float data[];
+};
+
+struct framebus {
+	char *name;
+	int writer;
+	size_t size;
+	struct fb_header *hdr;
+	unsigned char *slots;
+};
+
+/* Create the object. name is as in shm_open (e.g. "/rtfi"). An existing
+ * object is not replaced: it may belong to a running instance.
+ * Returns -E_OK, -E_NOMEM or -E_OTHER. */
+extern int framebus_create(struct framebus *fb, const char *name,
+					int sample_rate, int hop);
+
+/* Frame sink (see rtfi_add_sink) */
+extern void framebus_push(void *fb, const float *frame);
+
+/* Attach to an existing object, read-only. Returns -E_OK, -E_BADCFG if it is
+ * not a frame bus or -E_OTHER. */
+extern int framebus_attach(struct framebus *fb, const char *name);
+
+/* Close the mapping. The writer also removes the object. */
+extern void framebus_close(struct framebus *fb);
+
+/* Frames published so far. The last one is frame framebus_head(fb) - 1 */
+extern uint64_t framebus_head(const struct framebus *fb);
+
+/* Zero-copy read: framebus_peek() returns the frame data in place and the slot
+ * sequence in *seq; the data may only be trusted if framebus_check() returns
+ * non-zero afterwards. Returns NULL if frame n is not available (too old, not
+ * yet published or being written). */
+extern const float *framebus_peek(const struct framebus *fb, uint64_t n,
+							uint32_t *seq);
+extern int framebus_check(const struct framebus *fb, uint64_t n, uint32_t seq);
+
+/* Copy frame n into data (n_bands values). Returns -E_OK, or -E_OTHER if the
+ * frame is not available. */
+extern int framebus_read(const struct framebus *fb, uint64_t n, float *data);
+
+#endif /* _FRAMEBUS_H_ */
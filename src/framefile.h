@@ -0,0 +1,106 @@
+/*
+ * framefile.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _FRAMEFILE_H_
+#define _FRAMEFILE_H_
+
+#include <stdint.h>
+#include <math.h>
+
+/* On-disk format for recorded ARTFI frames.
+ *
+ * The file starts with a struct ff_header, followed by any number of chunks.
+ * Each chunk is a struct ff_chunk followed by n_frames * n_bands samples of
+ * qbits bits. A sample is the level of a band in dB (20*log10 of the frame
+ * value, as shown by the visualizer), quantized as
+ *	q = round((dB - db_lo) / db_step), clamped to [0, 2^qbits - 1]
+ * Bands are stored in the same order as in rtfi_blocks (highest first).
+ *
+ * If FF_DELTA is set, the first frame of each chunk is stored as is and the
+ * following ones as the difference (modulo 2^qbits) with the previous frame.
+ *
+ * A chunk has consecutive frames only: if frames are lost, a new chunk starts.
+ * All fields are in the byte order of the machine that wrote the file (all
+ * supported platforms are little-endian). */
+
+#define FF_MAGIC "ARTF"
+#define FF_CHUNK_MAGIC "CHNK"
+#define FF_VERSION 1
+
+enum FF_FLAGS {FF_DELTA = 1};
+
+struct ff_header {
+	char magic[4];
+	uint16_t version;
+	uint16_t flags;
+	uint16_t n_bands;
+	uint16_t fxst;
+	uint16_t qbits;
+	uint16_t reserved;
+	/* input samples per frame */
+	uint32_t hop;
+	uint32_t sample_rate;
+	float db_lo, db_step;
+	/* maximum frames per chunk */
+	uint32_t chunk_frames;
+	uint32_t reserved2;
+	/* CLOCK_REALTIME when the recording was started, in ns */
+	int64_t start_ns;
+};
+
+struct ff_chunk {
+	char magic[4];
+	uint32_t n_frames;
+	/* frame number (since the start of the recording) of the first frame */
+	uint64_t first_frame;
+	/* CLOCK_REALTIME of the first frame, in ns */
+	int64_t time_ns;
+	/* payload size in bytes */
+	uint32_t size;
+	uint32_t reserved;
+};
+
+/* Default quantization ranges */
+#define FF_DB_LO8 (-160.0f)
+#define FF_DB_STEP8 (160.0f / 255)
+#define FF_DB_LO16 (-200.0f)
+#define FF_DB_STEP16 (1.0f / 256)
+
+static inline unsigned int ff_quantize(float db, float lo, float step,
+								int qbits)
+{
+	float l = (db - lo) / step;
+	float maxq = (float)((1 << qbits) - 1);
+
+	return (l > 0)? (unsigned int)((l < maxq)? (l + 0.5f) : maxq) : 0;
+}
+
+static inline float ff_level(unsigned int q, float lo, float step)
+{
+	return lo + (float)q * step;
+}
+
+static inline int ff_sample_size(int qbits)
+{
+	return (qbits > 8)? 2 : 1;
+}
+
+#endif /* _FRAMEFILE_H_ */
@@ -0,0 +1,291 @@
+/*
+ * framereader.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <libjc/common.h>
+#include "framereader.h"
+
+static int check_header(const struct ff_header *h, size_t size)
+{
+	return size >= sizeof(*h)
+		&& memcmp(h->magic, FF_MAGIC, sizeof(h->magic)) == 0
+		&& h->version == FF_VERSION
+		&& (h->qbits == 8 || h->qbits == 16)
+		&& h->n_bands > 0 && h->chunk_frames > 0;
+}
+
+static int scan_chunks(struct ff_reader *r)
+{ /* Build the chunk index. A truncated last chunk is ignored. */
+	const size_t frame_size = r->hdr->n_bands
+				* (size_t)ff_sample_size(r->hdr->qbits);
+	size_t off = sizeof(struct ff_header);
+	int n = 0, cap = 0;
+
+	r->chunks = NULL;
+	r->end_frame = 0;
+
+	while (off + sizeof(struct ff_chunk) <= r->size) {
+		struct ff_chunk c;
+
+		/* the payload may not be aligned for the struct */
+		memcpy(&c, r->map + off, sizeof(c));
+		if (memcmp(c.magic, FF_CHUNK_MAGIC, sizeof(c.magic)) != 0
+		    || c.size != c.n_frames * frame_size
+		    || off + sizeof(c) + c.size > r->size)
+			break;
+
+		if (n == cap) {
+			struct ff_chunk_ref *tmp;
+
+			cap = cap? cap * 2 : 64;
+			if ((tmp = realloc(r->chunks,
+					(size_t)cap * sizeof(*tmp))) == NULL)
+				return -E_NOMEM;
+			r->chunks = tmp;
+		}
+
+		r->chunks[n].first_frame = c.first_frame;
+		r->chunks[n].n_frames = c.n_frames;
+		r->chunks[n].offset = off + sizeof(c);
+		r->end_frame = c.first_frame + c.n_frames;
+		n++;
+
+		off += sizeof(c) + c.size;
+	}
+
+	r->n_chunks = n;
+	return -E_OK;
+}
+
+static int build_buckets(struct ff_reader *r)
+{
+	const uint32_t cf = r->hdr->chunk_frames;
+	uint64_t b;
+	int k = 0;
+
+	r->n_buckets = (r->end_frame + cf - 1) / cf;
+	if (NMALLOC(r->buckets, r->n_buckets + 1) == NULL)
+		return -E_NOMEM;
+
+	for (b = 0; b <= r->n_buckets; b++) {
+		while (k < r->n_chunks && r->chunks[k].first_frame
+					+ r->chunks[k].n_frames <= b * cf)
+			k++;
+		r->buckets[b] = k;
+	}
+
+	return -E_OK;
+}
+
+int ff_open(struct ff_reader *r, const char *path)
+{
+	struct stat st;
+	int fd, ret;
+
+	r->map = NULL;
+	r->chunks = NULL;
+	r->buckets = NULL;
+
+	if ((fd = open(path, O_RDONLY)) < 0 || fstat(fd, &st) != 0) {
+		PERROR("cannot open %s\n", path);
+		if (fd >= 0)
+			close(fd);
+		return -E_OTHER;
+	}
+
+	r->size = (size_t)st.st_size;
+	r->map = mmap(NULL, r->size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (r->map == MAP_FAILED) {
+		r->map = NULL;
+		return -E_OTHER;
+	}
+
+	/* Reading will be mostly sequential */
+	madvise((void *)r->map, r->size, MADV_SEQUENTIAL);
+
+	r->hdr = (const struct ff_header *)r->map;
+	if (!check_header(r->hdr, r->size)) {
+		PERROR("%s is not a frame file\n", path);
+		ret = -E_BADCFG;
+	} else if ((ret = scan_chunks(r)) == -E_OK) {
+		ret = build_buckets(r);
+	}
+
+	if (ret != -E_OK)
+		ff_close(r);
+
+	return ret;
+}
+
+void ff_close(struct ff_reader *r)
+{
+	if (r->map != NULL)
+		munmap((void *)r->map, r->size);
+	free(r->chunks);
+	free(r->buckets);
+	r->map = NULL;
+	r->chunks = NULL;
+	r->buckets = NULL;
+}
+
+uint64_t ff_time2frame(const struct ff_reader *r, double t)
+{
+	double f = t * r->hdr->sample_rate / r->hdr->hop;
+
+	return (f > 0)? (uint64_t)(f + 0.5) : 0;
+}
+
+int ff_cursor_init(struct ff_cursor *c, const struct ff_reader *r)
+{
+	c->r = r;
+	c->chunk = 0;
+	c->pos = 0;
+
+	return (NCALLOC(c->acc, r->hdr->n_bands) == NULL)? -E_NOMEM : -E_OK;
+}
+
+void ff_cursor_free(struct ff_cursor *c)
+{
+	free(c->acc);
+	c->acc = NULL;
+}
+
+static inline unsigned int sample(const struct ff_reader *r, size_t offset,
+							size_t i)
+{
+	const void *p = r->map + offset;
+
+	return (r->hdr->qbits > 8)? ((const uint16_t *)p)[i]
+				  : ((const uint8_t *)p)[i];
+}
+
+static void accumulate(struct ff_cursor *c, const struct ff_chunk_ref *ch,
+							uint32_t pos)
+{ /* Update c->acc with the quantized values of frame pos in the chunk */
+	const struct ff_reader *r = c->r;
+	const int nb = r->hdr->n_bands;
+	const unsigned int mask = (1u << r->hdr->qbits) - 1;
+	size_t base = (size_t)pos * (size_t)nb;
+	int i;
+
+	if ((r->hdr->flags & FF_DELTA) && pos > 0) {
+		for (i = 0; i < nb; i++)
+			c->acc[i] = (c->acc[i] + sample(r, ch->offset,
+						base + (size_t)i)) & mask;
+	} else {
+		for (i = 0; i < nb; i++)
+			c->acc[i] = sample(r, ch->offset, base + (size_t)i);
+	}
+}
+
+void ff_cursor_seek(struct ff_cursor *c, uint64_t frame)
+{
+	const struct ff_reader *r = c->r;
+	uint64_t b = frame / r->hdr->chunk_frames;
+	int k = (b < r->n_buckets)? r->buckets[b] : r->n_chunks;
+	uint32_t p;
+
+	while (k < r->n_chunks && r->chunks[k].first_frame
+					+ r->chunks[k].n_frames <= frame)
+		k++;
+
+	c->chunk = k;
+	c->pos = 0;
+	if (k >= r->n_chunks || r->chunks[k].first_frame >= frame)
+		return;
+
+	/* delta coded frames depend on all the previous ones in the chunk */
+	c->pos = (uint32_t)(frame - r->chunks[k].first_frame);
+	if (r->hdr->flags & FF_DELTA) {
+		for (p = 0; p < c->pos; p++)
+			accumulate(c, &r->chunks[k], p);
+	}
+}
+
+static const struct ff_chunk_ref *advance(struct ff_cursor *c, uint32_t *pos,
+							uint64_t *frame)
+{ /* Return the chunk of the frame at the cursor and move past it */
+	const struct ff_reader *r = c->r;
+	const struct ff_chunk_ref *ch;
+
+	if (c->chunk < r->n_chunks && c->pos >= r->chunks[c->chunk].n_frames) {
+		c->chunk++;
+		c->pos = 0;
+	}
+	if (c->chunk >= r->n_chunks)
+		return NULL;
+
+	ch = &r->chunks[c->chunk];
+	*pos = c->pos++;
+	if (frame != NULL)
+		*frame = ch->first_frame + *pos;
+
+	return ch;
+}
+
+const unsigned int *ff_cursor_next_q(struct ff_cursor *c, uint64_t *frame)
+{
+	const struct ff_chunk_ref *ch;
+	uint32_t pos;
+
+	if ((ch = advance(c, &pos, frame)) == NULL)
+		return NULL;
+
+	accumulate(c, ch, pos);
+	return c->acc;
+}
+
+int ff_cursor_next(struct ff_cursor *c, float *db, uint64_t *frame)
+{
+	const struct ff_header *h = c->r->hdr;
+	const unsigned int *q;
+	int i;
+
+	if ((q = ff_cursor_next_q(c, frame)) == NULL)
+		return -E_OTHER;
+
+	for (i = 0; i < h->n_bands; i++)
+		db[i] = ff_level(q[i], h->db_lo, h->db_step);
+
+	return -E_OK;
+}
+
+const void *ff_cursor_next_raw(struct ff_cursor *c, uint64_t *frame)
+{
+	const struct ff_header *h = c->r->hdr;
+	const struct ff_chunk_ref *ch;
+	uint32_t pos;
+
+	if ((h->flags & FF_DELTA) || (ch = advance(c, &pos, frame)) == NULL)
+		return NULL;
+
+	return c->r->map + ch->offset
+			+ (size_t)pos * h->n_bands
+			* (size_t)ff_sample_size(h->qbits);
+}
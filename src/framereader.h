@@ -0,0 +1,95 @@
+/*
+ * framereader.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _FRAMEREADER_H_
+#define _FRAMEREADER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "framefile.h"
+
+/* Read frame files (see framefile.h) through a memory map.
+ *
+ * When opening, the chunk headers are scanned to build an index of chunks, and
+ * a table with the first chunk of each run of chunk_frames frames, so that
+ * finding the chunk that has a given frame takes a lookup plus a short scan.
+ * Times are converted to frame numbers using the hop and sample rate. */
+
+struct ff_chunk_ref {
+	uint64_t first_frame;
+	uint32_t n_frames;
+	/* offset of the payload in the file */
+	size_t offset;
+};
+
+struct ff_reader {
+	const unsigned char *map;
+	size_t size;
+	const struct ff_header *hdr;
+	struct ff_chunk_ref *chunks;
+	int n_chunks;
+	/* first chunk ending after frame k*chunk_frames */
+	int *buckets;
+	uint64_t n_buckets;
+	/* one past the last frame number */
+	uint64_t end_frame;
+};
+
+/* A position in the file, for reading frames in sequence */
+struct ff_cursor {
+	const struct ff_reader *r;
+	int chunk;
+	uint32_t pos;
+	/* last decoded frame, needed to undo the delta coding */
+	unsigned int *acc;
+};
+
+/* Returns -E_OK, -E_BADCFG if the file is not a valid frame file, -E_OTHER
+ * if it cannot be read or -E_NOMEM. */
+extern int ff_open(struct ff_reader *r, const char *path);
+extern void ff_close(struct ff_reader *r);
+
+/* Frame number of the first frame at or after t seconds from the start of
+ * the recording. */
+extern uint64_t ff_time2frame(const struct ff_reader *r, double t);
+
+extern int ff_cursor_init(struct ff_cursor *c, const struct ff_reader *r);
+extern void ff_cursor_free(struct ff_cursor *c);
+
+/* Position the cursor at the first recorded frame with number >= frame */
+extern void ff_cursor_seek(struct ff_cursor *c, uint64_t frame);
+
+/* Decode the frame at the cursor into n_bands dB values and advance.
+ * Returns -E_OTHER at the end of the file. The frame number is stored in
+ * *frame. */
+extern int ff_cursor_next(struct ff_cursor *c, float *db, uint64_t *frame);
+
+/* Same, but return the quantized values (valid until the next call), or NULL
+ * at the end of the file. */
+extern const unsigned int *ff_cursor_next_q(struct ff_cursor *c,
+							uint64_t *frame);
+
+/* Pointer to the quantized samples of the frame at the cursor, without
+ * copying (only for files without delta coding; NULL otherwise or at the
+ * end). The cursor is advanced. */
+extern const void *ff_cursor_next_raw(struct ff_cursor *c, uint64_t *frame);
+
+#endif /* _FRAMEREADER_H_ */
@@ -0,0 +1,187 @@
+/*
+ * framewriter.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <semaphore.h>
+#include <libjc/common.h>
+#include "rtfi.h"
+#include "framefile.h"
+#include "framewriter.h"
+#include "kernels.h"
+
+struct ff_writer {
+	FILE *f;
+	struct ff_header hdr;
+
+	/* chunk being assembled */
+	struct ff_chunk chunk;
+	unsigned char *payload;
+	unsigned int prev[ARTFI_BSIZE];
+
+	int error;
+};
+
+static int flush_chunk(struct ff_writer *w)
+{
+	struct ff_chunk *c = &w->chunk;
+
+	if (c->n_frames == 0)
+		return -E_OK;
+
+	c->size = c->n_frames * w->hdr.n_bands
+			* (uint32_t)ff_sample_size(w->hdr.qbits);
+
+	if (fwrite(c, sizeof(*c), 1, w->f) != 1
+	    || fwrite(w->payload, c->size, 1, w->f) != 1)
+		return -E_OTHER;
+
+	c->n_frames = 0;
+	return -E_OK;
+}
+
+int ff_writer_put(struct ff_writer *w, uint64_t frame_no, int64_t time_ns,
+							const float *frame)
+{ /* Add a frame to the current chunk, writing the chunk if needed */
+	const struct ff_header *h = &w->hdr;
+	struct ff_chunk *c = &w->chunk;
+	float db[ARTFI_BSIZE];
+	int i, r = -E_OK, delta;
+	unsigned int mask = (1u << h->qbits) - 1;
+	size_t offset;
+
+	if (w->error)
+		return -E_OTHER;
+
+	if (c->n_frames > 0 && (c->n_frames >= h->chunk_frames
+			|| frame_no != c->first_frame + c->n_frames)
+	    && (r = flush_chunk(w)) != -E_OK) {
+		/* the chunk is lost, and so are the frames after it */
+		c->n_frames = 0;
+		w->error = 1;
+		return r;
+	}
+
+	if (c->n_frames == 0) {
+		c->first_frame = frame_no;
+		c->time_ns = time_ns;
+	}
+
+	delta = (h->flags & FF_DELTA) && c->n_frames > 0;
+	offset = (size_t)c->n_frames * h->n_bands;
+
+	kern->db(db, frame, h->n_bands, 20);
+	for (i = 0; i < h->n_bands; i++) {
+		unsigned int q = ff_quantize(db[i], h->db_lo, h->db_step, h->qbits);
+		unsigned int v = delta? ((q - w->prev[i]) & mask) : q;
+
+		if (h->qbits > 8)
+			((uint16_t *)w->payload)[offset + (size_t)i] =
+								(uint16_t)v;
+		else
+			w->payload[offset + (size_t)i] = (unsigned char)v;
+		w->prev[i] = q;
+	}
+
+	c->n_frames++;
+
+	return -E_OK;
+}
+
+struct ff_writer *ff_writer_open(const char *path, int qbits, int delta,
+		int sample_rate, int hop, int64_t start_ns, int *ecode)
+{
+	struct ff_writer *w;
+	int r = -E_OK;
+
+	if (qbits != 8 && qbits != 16) {
+		r = -E_BADCFG;
+		goto disaster;
+	}
+
+	if (__CALLOC(w) == NULL) {
+		r = -E_NOMEM;
+		goto disaster;
+	}
+
+	memcpy(w->hdr.magic, FF_MAGIC, sizeof(w->hdr.magic));
+	w->hdr.version = FF_VERSION;
+	w->hdr.flags = delta? FF_DELTA : 0;
+	w->hdr.n_bands = ARTFI_BSIZE;
+	w->hdr.fxst = FXST;
+	w->hdr.qbits = (uint16_t)qbits;
+	w->hdr.hop = (uint32_t)hop;
+	w->hdr.sample_rate = (uint32_t)sample_rate;
+	w->hdr.db_lo = (qbits > 8)? FF_DB_LO16 : FF_DB_LO8;
+	w->hdr.db_step = (qbits > 8)? FF_DB_STEP16 : FF_DB_STEP8;
+	w->hdr.chunk_frames = FF_CHUNK_FRAMES;
+	w->hdr.start_ns = start_ns;
+	memcpy(w->chunk.magic, FF_CHUNK_MAGIC, sizeof(w->chunk.magic));
+
+	if (NMALLOC(w->payload, (size_t)FF_CHUNK_FRAMES * ARTFI_BSIZE
+					* (size_t)ff_sample_size(qbits)) == NULL) {
+		r = -E_NOMEM;
+		goto free_w;
+	}
+
+	if ((w->f = fopen(path, "wb")) == NULL) {
+		PERROR("cannot open %s\n", path);
+		r = -E_OTHER;
+		goto free_payload;
+	}
+
+	if (fwrite(&w->hdr, sizeof(w->hdr), 1, w->f) != 1) {
+		r = -E_OTHER;
+		goto close_file;
+	}
+
+	if (ecode != NULL)
+		*ecode = r;
+	return w;
+
+close_file:
+	fclose(w->f);
+free_payload:
+	free(w->payload);
+free_w:
+	free(w);
+disaster:
+	if (ecode != NULL)
+		*ecode = r;
+	return NULL;
+}
+
+int ff_writer_close(struct ff_writer *w)
+{
+	int r = -E_OK;
+
+	if (flush_chunk(w) != -E_OK || w->error)
+		r = -E_OTHER;
+	if (fclose(w->f) != 0)
+		r = -E_OTHER;
+
+	free(w->payload);
+	free(w);
+
+	return r;
+}
@@ -0,0 +1,51 @@
+/*
+ * framewriter.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _FRAMEWRITER_H_
+#define _FRAMEWRITER_H_
+
+#include <stdint.h>
+
+/* Write frame files (see framefile.h). Frames are given as in rtfi_blocks
+ * (not in dB) and are buffered until a chunk is complete. */
+
+/* 1 second of frames */
+#define FF_CHUNK_FRAMES 100
+
+struct ff_writer;
+
+/* qbits must be 8 or 16. start_ns goes in the header. Returns NULL on error,
+ * with the error code in *ecode. */
+extern struct ff_writer *ff_writer_open(const char *path, int qbits,
+		int delta, int sample_rate, int hop, int64_t start_ns,
+		int *ecode);
+
+/* Add a frame. frame_no must increase; if it is not the next one, a new
+ * chunk is started. Returns -E_OK or -E_OTHER on a write error; after one,
+ * the frames are dropped and every call returns -E_OTHER. */
+extern int ff_writer_put(struct ff_writer *w, uint64_t frame_no,
+				int64_t time_ns, const float *frame);
+
+/* Write the pending frames and close the file. Returns -E_OK, or -E_OTHER if
+ * there was any write error. */
+extern int ff_writer_close(struct ff_writer *w);
+
+#endif /* _FRAMEWRITER_H_ */
@@ -0,0 +1,143 @@
+/*
+ * history.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdlib.h>
+#include <libjc/common.h>
+#include "history.h"
+
+#define HIST_STEP ((HIST_DB_HI - HIST_DB_LO) / HIST_MAXQ)
+
+static inline hist_t hist_quantize(float db)
+{
+	float l = (db - HIST_DB_LO) * (1 / HIST_STEP);
+
+	return (l > 0)? ((l < HIST_MAXQ)? (hist_t)(l + 0.5f) : HIST_MAXQ) : 0;
+}
+
+static inline float hist_level(hist_t q)
+{
+	return HIST_DB_LO + q * HIST_STEP;
+}
+
+int history_init(struct history *h, int len, int level_len)
+{
+	int l, p, r = -E_OK;
+
+	for (l = 0; l <= HIST_LEVELS; l++) {
+		struct hist_level *lv = &h->levels[l];
+
+		lv->len = (l == 0)? len : level_len;
+		lv->count = 0;
+
+		for (p = 0; p < HIST_N_PLANES; p++) {
+			if (l == 0 && p > 0)
+				lv->planes[p] = lv->planes[0];
+			else if (NCALLOC(lv->planes[p], (size_t)lv->len
+							* HIST_NBANDS) == NULL)
+				r = -E_NOMEM;
+		}
+	}
+
+	if (r != -E_OK)
+		history_free(h);
+
+	return r;
+}
+
+void history_free(struct history *h)
+{
+	int l, p;
+
+	for (l = 0; l <= HIST_LEVELS; l++) {
+		struct hist_level *lv = &h->levels[l];
+
+		for (p = 0; p < HIST_N_PLANES; p++) {
+			if (l > 0 || p == 0)
+				free(lv->planes[p]);
+			lv->planes[p] = NULL;
+		}
+	}
+}
+
+static inline hist_t *entry(const struct hist_level *lv, int plane,
+							unsigned long n)
+{
+	return lv->planes[plane] + (n % (unsigned long)lv->len) * HIST_NBANDS;
+}
+
+static void aggregate(struct history *h, int l)
+{ /* Combine the last two entries of level l - 1 into a new entry of level l */
+	const struct hist_level *src = &h->levels[l - 1];
+	struct hist_level *dst = &h->levels[l];
+	const hist_t *am = entry(src, HIST_MEAN, src->count - 2);
+	const hist_t *bm = entry(src, HIST_MEAN, src->count - 1);
+	const hist_t *ax = entry(src, HIST_MAX, src->count - 2);
+	const hist_t *bx = entry(src, HIST_MAX, src->count - 1);
+	hist_t *mean = entry(dst, HIST_MEAN, dst->count);
+	hist_t *max = entry(dst, HIST_MAX, dst->count);
+	int i;
+
+	for (i = 0; i < HIST_NBANDS; i++) {
+		mean[i] = (hist_t)((am[i] + bm[i] + 1) >> 1);
+		max[i] = (ax[i] > bx[i])? ax[i] : bx[i];
+	}
+
+	dst->count++;
+}
+
+void history_push(struct history *h, const float *db)
+{
+	struct hist_level *lv = &h->levels[0];
+	hist_t *dst = entry(lv, HIST_MEAN, lv->count);
+	int i, l;
+
+	for (i = 0; i < HIST_NBANDS; i++)
+		dst[i] = hist_quantize(db[i]);
+
+	lv->count++;
+
+	/* every second entry in a level completes one in the next */
+	for (l = 1; l <= HIST_LEVELS && !(h->levels[l - 1].count & 1); l++)
+		aggregate(h, l);
+}
+
+unsigned long history_count(const struct history *h, int level)
+{
+	return h->levels[level].count;
+}
+
+int history_get(const struct history *h, int level, int plane,
+					unsigned long n, float *db)
+{
+	const struct hist_level *lv = &h->levels[level];
+	const hist_t *src;
+	int i;
+
+	if (n >= lv->count || lv->count - n > (unsigned long)lv->len)
+		return -E_OTHER;
+
+	src = entry(lv, plane, n);
+
+	for (i = 0; i < HIST_NBANDS; i++)
+		db[i] = hist_level(src[i]);
+
+	return -E_OK;
+}
@@ -0,0 +1,84 @@
+/*
+ * history.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _HISTORY_H_
+#define _HISTORY_H_
+
+#include <stdint.h>
+#include "../src_generated/rtfi_defines.h"
+
+/* The history keeps the last HIST_LEN ARTFI frames, in dB, quantized to
+ * HIST_BITS bits between HIST_DB_LO and HIST_DB_HI. It is independent of what
+ * is being displayed, so that the image can be redrawn after a view change.
+ *
+ * On top of the raw frames (level 0) there is a pyramid of HIST_LEVELS levels.
+ * Each entry of level l summarizes 2^l frames with their mean and their
+ * maximum, and each level holds HIST_LEVEL_LEN entries. The pyramid is updated
+ * as frames arrive, so that a zoomed-out view costs the same as the normal
+ * one. */
+#define HIST_BITS 8
+#define HIST_MAXQ ((1 << HIST_BITS) - 1)
+#define HIST_DB_LO (-160.0f)
+#define HIST_DB_HI (0.0f)
+#define HIST_NBANDS REAL_N_BANDS
+
+/* 2^14 frames of 10ms is about 2.7 minutes */
+#define HIST_LEN (1 << 14)
+/* With 2^11 entries, the top level (1024 frames per entry) spans 5.8 hours */
+#define HIST_LEVELS 10
+#define HIST_LEVEL_LEN (1 << 11)
+
+#if HIST_BITS <= 8
+typedef uint8_t hist_t;
+#else
+typedef uint16_t hist_t;
+#endif
+
+enum HIST_PLANES {HIST_MEAN, HIST_MAX, HIST_N_PLANES};
+
+struct hist_level {
+	/* for level 0, both planes are the same buffer */
+	hist_t *planes[HIST_N_PLANES];
+	int len;
+	/* total number of entries produced */
+	unsigned long count;
+};
+
+struct history {
+	struct hist_level levels[HIST_LEVELS + 1];
+};
+
+extern int history_init(struct history *h, int len, int level_len);
+extern void history_free(struct history *h);
+
+/* Store a frame of HIST_NBANDS dB values. */
+extern void history_push(struct history *h, const float *db);
+
+/* Number of entries produced so far in a level. The newest one is count - 1 */
+extern unsigned long history_count(const struct history *h, int level);
+
+/* Get the n-th entry ever produced in a level (counting from 0) into db.
+ * Returns -E_OTHER (and does not touch db) if the entry is not in the
+ * history. */
+extern int history_get(const struct history *h, int level, int plane,
+					unsigned long n, float *db);
+
+#endif /* _HISTORY_H_ */
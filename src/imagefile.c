@@ -0,0 +1,332 @@
+/*
+ * imagefile.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <libjc/common.h>
+#include "imagefile.h"
+
+struct exporter {
+	const struct ff_reader *r;
+	const struct image_cfg *cfg;
+	/* shared by all workers, they are only read */
+	struct resampler rs;
+	struct RGB pal[INTENSITY_LEVELS];
+	/* frame number of column 0 */
+	uint64_t origin, end;
+	unsigned long n_cols;
+	int n_tiles;
+	/* next tile to render, taken with an atomic increment */
+	int next_tile;
+	int error;
+};
+
+/* Reads the frames one column at a time. A frame that belongs to a later
+ * column is kept until that column is requested. */
+struct column_reader {
+	struct ff_cursor cur;
+	float *db;
+	uint64_t frame;
+	int have, eof;
+};
+
+struct tile_worker {
+	struct exporter *x;
+	pthread_t thread;
+	struct column_reader cr;
+	struct pipeline pipe;
+	float *col;
+	intensity_t *tile;
+	unsigned char *line;
+};
+
+static int read_column(struct column_reader *cr, uint64_t lo, uint64_t hi,
+				int n_bands, int tpool, float *col)
+{ /* Combine the frames numbered [lo, hi) into col. Returns the number of
+	frames found */
+	int i, n = 0;
+
+	for (;;) {
+		if (!cr->have) {
+			if (cr->eof || ff_cursor_next(&cr->cur, cr->db,
+						&cr->frame) != -E_OK) {
+				cr->eof = 1;
+				break;
+			}
+			cr->have = 1;
+		}
+
+		if (cr->frame >= hi)
+			break;
+		cr->have = 0;
+		if (cr->frame < lo)
+			continue;
+
+		if (n == 0) {
+			memcpy(col, cr->db, (size_t)n_bands * sizeof(*col));
+		} else if (tpool == IMG_MAX) {
+			for (i = 0; i < n_bands; i++)
+				col[i] = fmaxf(col[i], cr->db[i]);
+		} else {
+			for (i = 0; i < n_bands; i++)
+				col[i] += cr->db[i];
+		}
+		n++;
+	}
+
+	if (tpool == IMG_MEAN && n > 1)
+		for (i = 0; i < n_bands; i++)
+			col[i] /= (float)n;
+
+	return n;
+}
+
+static unsigned long warm_start(const struct exporter *x, unsigned long c0)
+{ /* First column to process before column c0, so that the pipeline has seen
+	the same TIME_AVG columns as if rendering from the start. Columns
+	without frames do not count, as they do not go through the pipeline. */
+	const struct ff_reader *r = x->r;
+	const int z = x->cfg->tzoom;
+	const uint64_t lo = x->origin + ((uint64_t)c0 << z);
+	long c = (long)c0, cf, cl;
+	int k, a = 0, b = r->n_chunks, found = 0;
+
+	/* last chunk starting before column c0 */
+	while (b - a > 1) {
+		int mid = (a + b) / 2;
+
+		if (r->chunks[mid].first_frame < lo)
+			a = mid;
+		else
+			b = mid;
+	}
+
+	/* the columns covered by a chunk all have frames */
+	for (k = a; k >= 0 && found < TIME_AVG; k--) {
+		const struct ff_chunk_ref *ch = &r->chunks[k];
+		uint64_t last = ch->first_frame + ch->n_frames - 1;
+
+		if (ch->n_frames == 0 || ch->first_frame >= lo)
+			continue;
+		if (last < x->origin)
+			break;
+		if (last >= lo)
+			last = lo - 1;
+
+		cl = (long)((last - x->origin) >> z);
+		cf = (ch->first_frame > x->origin)?
+				(long)((ch->first_frame - x->origin) >> z) : 0;
+		if (cl >= c)
+			cl = c - 1;
+		for (; cl >= cf && found < TIME_AVG; cl--, found++)
+			c = cl;
+	}
+
+	return (unsigned long)c;
+}
+
+static int write_tile(struct tile_worker *wk, int t, int width)
+{ /* Convert the tile to colors and write it */
+	const struct exporter *x = wk->x;
+	const int rows = x->cfg->rows, stride = x->cfg->tile_w;
+	char path[strlen(x->cfg->prefix) + sizeof("-0000000000.ppm")];
+	int y, i, r = -E_OK;
+	FILE *f;
+
+	sprintf(path, "%s-%04d.ppm", x->cfg->prefix, t);
+	if ((f = fopen(path, "wb")) == NULL) {
+		PERROR("image: cannot write %s\n", path);
+		return -E_OTHER;
+	}
+
+	fprintf(f, "P6\n%d %d\n255\n", width, rows);
+	for (y = 0; y < rows; y++) {
+		const intensity_t *src = wk->tile + y*stride;
+
+		for (i = 0; i < width; i++) {
+			struct RGB c = x->pal[src[i]];
+
+			wk->line[3*i] = c.r;
+			wk->line[3*i + 1] = c.g;
+			wk->line[3*i + 2] = c.b;
+		}
+		if (fwrite(wk->line, 3, (size_t)width, f) != (size_t)width)
+			r = -E_OTHER;
+	}
+
+	if (fclose(f) != 0)
+		r = -E_OTHER;
+	if (r != -E_OK)
+		PERROR("image: error writing %s\n", path);
+
+	return r;
+}
+
+static int render_tile(struct tile_worker *wk, int t)
+{
+	const struct exporter *x = wk->x;
+	const struct image_cfg *cfg = x->cfg;
+	const int n_bands = x->r->hdr->n_bands, stride = cfg->tile_w;
+	const unsigned long tile_w = (unsigned long)cfg->tile_w;
+	unsigned long c0 = (unsigned long)t * tile_w, c1, c;
+	unsigned long warm = warm_start(x, c0);
+	int y;
+
+	c1 = (c0 + tile_w < x->n_cols)? c0 + tile_w : x->n_cols;
+
+	pipeline_reset(&wk->pipe);
+	wk->cr.have = 0;
+	wk->cr.eof = 0;
+	ff_cursor_seek(&wk->cr.cur, x->origin + ((uint64_t)warm << cfg->tzoom));
+
+	for (c = warm; c < c1; c++) {
+		uint64_t lo = x->origin + ((uint64_t)c << cfg->tzoom);
+		uint64_t hi = lo + ((uint64_t)1 << cfg->tzoom);
+		intensity_t *col = wk->tile + (c - c0);
+		int n;
+
+		if (hi > x->end)
+			hi = x->end;
+		n = read_column(&wk->cr, lo, hi, n_bands, cfg->tpool, wk->col);
+
+		/* As in the visualizer, missing frames leave the column empty
+		 * and do not go through the pipeline */
+		if (c < c0) {
+			if (n)
+				pipeline_step(&wk->pipe, wk->col, cfg->mode);
+		} else if (n) {
+			render_column(&wk->pipe, wk->col, cfg->mode, &x->rs, col,
+									stride);
+		} else {
+			for (y = 0; y < cfg->rows; y++)
+				col[y*stride] = 0;
+		}
+	}
+
+	return write_tile(wk, t, (int)(c1 - c0));
+}
+
+static void *tile_run(void *arg)
+{
+	struct tile_worker *wk = arg;
+	struct exporter *x = wk->x;
+	int t;
+
+	while ((t = __atomic_fetch_add(&x->next_tile, 1, __ATOMIC_RELAXED))
+								< x->n_tiles) {
+		if (render_tile(wk, t) != -E_OK)
+			__atomic_store_n(&x->error, 1, __ATOMIC_RELAXED);
+	}
+
+	return NULL;
+}
+
+static int worker_init(struct tile_worker *wk, struct exporter *x)
+{
+	const struct image_cfg *cfg = x->cfg;
+	const int n_bands = x->r->hdr->n_bands;
+
+	memset(wk, 0, sizeof(*wk));
+	wk->x = x;
+
+	if (ff_cursor_init(&wk->cr.cur, x->r) != -E_OK
+	    || NMALLOC(wk->cr.db, (size_t)n_bands) == NULL
+	    || NMALLOC(wk->col, (size_t)n_bands) == NULL
+	    || NMALLOC(wk->tile, (size_t)cfg->tile_w * (size_t)cfg->rows)
+								== NULL
+	    || NMALLOC(wk->line, 3 * (size_t)cfg->tile_w) == NULL)
+		return -E_NOMEM;
+
+	return -E_OK;
+}
+
+static void worker_free(struct tile_worker *wk)
+{
+	ff_cursor_free(&wk->cr.cur);
+	free(wk->cr.db);
+	free(wk->col);
+	free(wk->tile);
+	free(wk->line);
+}
+
+int image_export(const struct ff_reader *r, const struct image_cfg *cfg)
+{
+	struct exporter x;
+	struct tile_worker *workers;
+	int i, n_workers, n_started = 0, ret = -E_OK;
+
+	if (r->hdr->n_bands < REAL_N_BANDS || cfg->tile_w < 1 || cfg->rows < 1
+	    || cfg->jobs < 1)
+		return -E_BADCFG;
+
+	memset(&x, 0, sizeof(x));
+	x.r = r;
+	x.cfg = cfg;
+	x.origin = cfg->start;
+	if (r->n_chunks > 0 && r->chunks[0].first_frame > x.origin)
+		x.origin = r->chunks[0].first_frame;
+	x.end = (cfg->end && cfg->end < r->end_frame)? cfg->end : r->end_frame;
+	if (x.end <= x.origin)
+		return -E_OK;
+
+	x.n_cols = ((x.end - x.origin - 1) >> cfg->tzoom) + 1;
+	x.n_tiles = (int)((x.n_cols - 1) / (unsigned long)cfg->tile_w + 1);
+	render_palette(x.pal, cfg->mode, &cfg->contrast, cfg->cmap);
+	if ((ret = resampler_init(&x.rs, cfg->rows, REAL_N_BANDS, cfg->base,
+					cfg->span, cfg->fpool)) != -E_OK)
+		return ret;
+
+	n_workers = (cfg->jobs < x.n_tiles)? cfg->jobs : x.n_tiles;
+	if (NCALLOC(workers, (size_t)n_workers) == NULL) {
+		ret = -E_NOMEM;
+		goto free_rs;
+	}
+
+	for (i = 0; i < n_workers; i++) {
+		if ((ret = worker_init(&workers[i], &x)) != -E_OK)
+			goto free_workers;
+	}
+
+	/* the calling thread is the first worker */
+	for (i = 1; i < n_workers; i++) {
+		if (pthread_create(&workers[i].thread, NULL, tile_run,
+							&workers[i]) != 0)
+			break;
+		n_started++;
+	}
+	tile_run(&workers[0]);
+	for (i = 1; i <= n_started; i++)
+		pthread_join(workers[i].thread, NULL);
+
+	if (x.error)
+		ret = -E_OTHER;
+
+free_workers:
+	for (i = 0; i < n_workers; i++)
+		worker_free(&workers[i]);
+	free(workers);
+free_rs:
+	resampler_free(&x.rs);
+	return ret;
+}
@@ -0,0 +1,66 @@
+/*
+ * imagefile.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _IMAGEFILE_H_
+#define _IMAGEFILE_H_
+
+#include <stdint.h>
+#include "render.h"
+#include "framereader.h"
+
+/* Render a frame file to images, with the same modes and colormaps as the
+ * visualizer.
+ *
+ * The image is cut along time into tiles of at most tile_w columns, written
+ * as binary PPM files named <prefix>-NNNN.ppm (tile 0 is the oldest). Tiles
+ * are rendered in parallel by "jobs" threads, each holding one tile at a
+ * time, so memory use does not depend on the length of the file. Each tile
+ * starts by processing the TIME_AVG columns (with frames) before it, so that
+ * the time averaged modes do not show the seams. */
+
+#define IMG_TILE_W 4096
+
+enum IMG_TPOOL {IMG_MEAN, IMG_MAX};
+
+struct image_cfg {
+	const char *prefix;
+	int mode;
+	unsigned int cmap;
+	struct contrast contrast;
+	/* the image has "rows" rows, showing "span" bands starting at "base"
+	 * (see resample.h) */
+	int rows;
+	double base, span;
+	int fpool;
+	/* each column summarizes 2^tzoom frames with their mean or max */
+	int tzoom;
+	int tpool;
+	/* frames to render, end = 0 means up to the end of the file */
+	uint64_t start, end;
+	int tile_w;
+	int jobs;
+};
+
+/* Returns -E_OK, -E_BADCFG if the file does not have enough bands, -E_NOMEM or
+ * -E_OTHER if a tile cannot be written. */
+extern int image_export(const struct ff_reader *r, const struct image_cfg *cfg);
+
+#endif /* _IMAGEFILE_H_ */
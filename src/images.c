@@ -21,6 +21,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <errno.h>
 #include <SDL/SDL.h>
@@ -29,9 +30,18 @@
 #include <jgl/view.h>
 #include <jgl/color.h>
 #include <jgl/input.h>
+#include <libjc/cmdopt/optparse.h>
 #include <libjc/common.h>
 #include "rtfi.h"
-#include "../src_generated/spectral_tables.c"
+#include "history.h"
+#include "resample.h"
+#include "recorder.h"
+#include "framereader.h"
+#include "player.h"
+#include "framebus.h"
+#include "pcminput.h"
+#include "render.h"
+#include "kernels.h"
 
 #ifdef DEBUG
 #define PDEBUG PERROR
@@ -50,34 +60,53 @@
 #define ACCEL_AMOUNT 100
 #define MODE_PLUS SDLK_RIGHT
 #define MODE_MINUS SDLK_LEFT
+#define PEAK_PLUS SDLK_PAGEUP
+#define PEAK_MINUS SDLK_PAGEDOWN
+#define RANGE_PLUS SDLK_HOME
+#define RANGE_MINUS SDLK_END
+#define CMAP_NEXT SDLK_c
+#define TZOOM_OUT SDLK_MINUS
+#define TZOOM_IN SDLK_EQUALS
+#define TPLANE_NEXT SDLK_m
+#define FZOOM_IN SDLK_i
+#define FZOOM_OUT SDLK_o
+#define FZOOM_FIT SDLK_f
+#define FPOOL_NEXT SDLK_p
+#define MIN_SPAN 16
+#define NO_ACCEL_CONTRAST 1
+#define ACCEL_CONTRAST 10
+#define MIN_RANGE 1
 
-#define TIME_AVG 5
-#define FREQ_AVG 5
-#define LOWER_THRS (90)
-#define PEAK_VALUE (-50) /* ?????????????? */
 #define MAX_FPS 60
 #define MIN_REFRESH_TIME (1000/MAX_FPS)
 
-#ifndef M_PI
-#define M_PI (3.14159265358979323846)
-#endif /* M_PI */
-
 #define ICONFILE "tficon.bmp"
 
-enum MODES {ARTFI, AES, PES, SPES, NPES, N_MODES};
-const char *modenames[] = {"ARTFI", "AES", "PES", "SPES", "NPES"};
-
 #define DEF_MODE ARTFI
 
 struct ui_ctrl {
 	int base_band;
+	/* number of bands shown in the screen height, and how they are combined
+	 * when there are more bands than rows */
+	int span;
+	unsigned int fpool;
 	int paused;
 	unsigned int mode;
 	int running;
 	int quit_requested;
+	/* initialized from default_contrast */
+	struct contrast contrast[N_MODES];
+	unsigned int cmap;
+	/* history level shown (each column is 2^tzoom frames) and whether the
+	 * mean or the max of the frames is shown */
+	int tzoom;
+	unsigned int tplane;
+	/* Incremented each time the contrast or colormap changes */
+	unsigned int style_gen;
 };
 
-static struct ui_ctrl uicontrol = {0, 0, DEF_MODE, 0, 0};
+static struct ui_ctrl uicontrol = {0, REAL_N_BANDS, RS_MAX, 0, DEF_MODE, 0, 0,
+	{{0, 0}}, CMAP_IRIS, 0, HIST_MEAN, 0};
 
 struct start_param {
 	int *r;
@@ -90,15 +119,260 @@ static int image_run(SDL_Surface *screen);
 static int event_parser(void *data);
 static int image_prepare(SDL_Surface **screen, int w, int h, int fs);
 
+enum {OPT_RECORD, OPT_RECBITS, OPT_RECDELTA, OPT_PLAY, OPT_SPEED, OPT_START,
+	OPT_SHM, OPT_INPUT, OPT_FORMAT, OPT_CHANNELS, OPT_RATE, OPT_REALTIME,
+	OPT_KERNELS, OPT_ARITH, OPT_DECIMATOR, OPT_ALIGN, OPT_HOP, OPT_MAXHOP,
+	OPT_REDUCER, OPT_HIGHPASS, OPT_SHELF, OPT_SHELFDB,
+	OPT_OCTAVEDB, OPT_HELP, N_OPTS};
+
+struct cmdline {
+	int w, h, fs;
+	int npos;
+	char *record;
+	int rec_bits;
+	int rec_delta;
+	char *play;
+	float speed;
+	double start;
+	char *shm;
+	char *input;
+	char *format;
+	int channels;
+	int rate;
+	int realtime;
+	char *kernels;
+	char *arith;
+	char *decimator;
+	char *align;
+	float hop, max_hop;
+	char *reducer;
+	float highpass, shelf, shelf_db;
+	char *octave_db;
+};
+
+static int positional_arg(int i, char *value, void *data)
+{ /* [width height] or f */
+	struct cmdline *cl = data;
+
+	(void)i;
+	if (cl->npos == 0 && value[0] == 'f' && value[1] == '\0') {
+		cl->fs = 1;
+		cl->npos = 2;
+	} else if (cl->npos == 0) {
+		cl->w = (int)strtol(value, NULL, 0);
+		cl->npos++;
+	} else if (cl->npos == 1) {
+		cl->h = (int)strtol(value, NULL, 0);
+		cl->npos++;
+	} else {
+		return -PARSE_BADSYNTAX;
+	}
+
+	return PARSE_OK;
+}
+
+static int parse_cmdline(int argc, char *argv[], struct cmdline *cl)
+{
+	struct opt_rule rules[N_OPTS];
+	int r;
+
+	set_parse_str_nocopy(&rules[OPT_RECORD], &cl->record);
+	set_parse_meta(&rules[OPT_RECORD], 'r', "record",
+		"Record the ARTFI frames to a file");
+	set_parse_int(&rules[OPT_RECBITS], &cl->rec_bits);
+	set_parse_meta(&rules[OPT_RECBITS], PARSE_NO_SHORT, "record-bits",
+		"Bits per recorded sample, 8 (default) or 16");
+	set_parse_bool(&rules[OPT_RECDELTA], &cl->rec_delta);
+	set_parse_meta(&rules[OPT_RECDELTA], PARSE_NO_SHORT, "record-delta",
+		"Store recorded frames as differences with the previous one");
+	set_parse_str_nocopy(&rules[OPT_PLAY], &cl->play);
+	set_parse_meta(&rules[OPT_PLAY], 'p', "play",
+		"Show a recorded file instead of the audio input");
+	set_parse_float(&rules[OPT_SPEED], &cl->speed);
+	set_parse_meta(&rules[OPT_SPEED], PARSE_NO_SHORT, "speed",
+		"Replay speed, 1 is real time (default), 0 as fast as possible");
+	set_parse_double(&rules[OPT_START], &cl->start);
+	set_parse_meta(&rules[OPT_START], PARSE_NO_SHORT, "start",
+		"Start replaying at this time (in seconds)");
+	set_parse_str_nocopy(&rules[OPT_SHM], &cl->shm);
+	set_parse_meta(&rules[OPT_SHM], 's', "shm",
+		"Publish the frames in a shared memory object (e.g. /rtfi)");
+	set_parse_str_nocopy(&rules[OPT_INPUT], &cl->input);
+	set_parse_meta(&rules[OPT_INPUT], 'i', "input",
+		"Read raw PCM from a file or FIFO (- for stdin) instead of JACK");
+	set_parse_str_nocopy(&rules[OPT_FORMAT], &cl->format);
+	set_parse_meta(&rules[OPT_FORMAT], PARSE_NO_SHORT, "format",
+		"Input sample format: s16 (default), s32 or f32");
+	set_parse_int(&rules[OPT_CHANNELS], &cl->channels);
+	set_parse_meta(&rules[OPT_CHANNELS], PARSE_NO_SHORT, "channels",
+		"Input channels, mixed to mono (default 1)");
+	set_parse_int(&rules[OPT_RATE], &cl->rate);
+	set_parse_meta(&rules[OPT_RATE], PARSE_NO_SHORT, "rate",
+		"Input sample rate: 44100, 48000 (default) or 96000");
+	set_parse_bool(&rules[OPT_REALTIME], &cl->realtime);
+	set_parse_meta(&rules[OPT_REALTIME], PARSE_NO_SHORT, "realtime",
+		"Process the input at its sample rate, not as fast as possible");
+	set_parse_str_nocopy(&rules[OPT_KERNELS], &cl->kernels);
+	set_parse_meta(&rules[OPT_KERNELS], PARSE_NO_SHORT, "kernels",
+		"Instruction set: auto (default), base, avx2 or avx512");
+	set_parse_str_nocopy(&rules[OPT_ARITH], &cl->arith);
+	set_parse_meta(&rules[OPT_ARITH], PARSE_NO_SHORT, "arith",
+		"Filterbank arithmetic: float (default) or q31 (fixed point)");
+	set_parse_str_nocopy(&rules[OPT_DECIMATOR], &cl->decimator);
+	set_parse_meta(&rules[OPT_DECIMATOR], PARSE_NO_SHORT, "decimator",
+		"Decimating filter: fir (default) or iir (allpass half-band)");
+	set_parse_str_nocopy(&rules[OPT_ALIGN], &cl->align);
+	set_parse_meta(&rules[OPT_ALIGN], PARSE_NO_SHORT, "align",
+		"Delay the octaves to match: none (default), decimators or full");
+	set_parse_float(&rules[OPT_HOP], &cl->hop);
+	set_parse_meta(&rules[OPT_HOP], PARSE_NO_SHORT, "hop",
+		"Time between frames, in ms (default 10)");
+	set_parse_float(&rules[OPT_MAXHOP], &cl->max_hop);
+	set_parse_meta(&rules[OPT_MAXHOP], PARSE_NO_SHORT, "max-hop",
+		"Average the lower octaves over up to this many ms");
+	set_parse_str_nocopy(&rules[OPT_REDUCER], &cl->reducer);
+	set_parse_meta(&rules[OPT_REDUCER], PARSE_NO_SHORT, "reducer",
+		"Power of each band in a frame: mean (default) or max");
+	set_parse_float(&rules[OPT_HIGHPASS], &cl->highpass);
+	set_parse_meta(&rules[OPT_HIGHPASS], PARSE_NO_SHORT, "highpass",
+		"High pass the input from this frequency, in Hz");
+	set_parse_float(&rules[OPT_SHELF], &cl->shelf);
+	set_parse_meta(&rules[OPT_SHELF], PARSE_NO_SHORT, "shelf",
+		"Low shelf the input below this frequency, in Hz");
+	set_parse_float(&rules[OPT_SHELFDB], &cl->shelf_db);
+	set_parse_meta(&rules[OPT_SHELFDB], PARSE_NO_SHORT, "shelf-db",
+		"Gain of the low shelf in dB (negative to cut)");
+	set_parse_str_nocopy(&rules[OPT_OCTAVEDB], &cl->octave_db);
+	set_parse_meta(&rules[OPT_OCTAVEDB], PARSE_NO_SHORT, "octave-db",
+		"Gains of the octaves in dB, the top one first: G,G,...");
+	set_parse_help(&rules[OPT_HELP]);
+	set_parse_meta(&rules[OPT_HELP], 'h', "help", "Show this help");
+
+	r = generic_parser(argc, argv, new_conf(rules, N_OPTS,
+		"rtfi visualizer, by Juan I Carrano\n"
+		"Usage: rtfi [options] [width height]\n"
+		"Fullscreen: rtfi [options] f\n",
+		1, positional_arg, cl));
+
+	if (r >= PARSE_OK && cl->npos == 1)
+		r = -PARSE_BADSYNTAX;
+
+	return r;
+}
+
+static int select_kernels(const char *name)
+{ /* Pick the kernels and tell which ones */
+	int r = kernels_select(name);
+
+	if (r == -E_BADARGS)
+		PERROR("Unknown kernels: %s\n", name);
+	else if (r == -E_BADCFG)
+		PERROR("This processor does not support the %s kernels\n", name);
+	else
+		PERROR("Using the %s kernels\n", kern->name);
+
+	return r;
+}
+
+static int select_filterbank(const struct cmdline *cl)
+{ /* Arithmetic, decimator, alignment, hop, reducer and equalizer of the
+	engines */
+	struct rtfi_eq eq;
+	int arith = rtfi_arith(cl->arith), dec = rtfi_decimator(cl->decimator);
+	int align = rtfi_align(cl->align), red = rtfi_reducer(cl->reducer);
+
+	if (arith < 0) {
+		PERROR("Unknown arithmetic: %s\n", cl->arith);
+		return -E_BADARGS;
+	}
+	if (dec < 0) {
+		PERROR("Unknown decimator: %s\n", cl->decimator);
+		return -E_BADARGS;
+	}
+	if (align < 0) {
+		PERROR("Unknown alignment: %s\n", cl->align);
+		return -E_BADARGS;
+	}
+	/* the others are not a power, or not one plane */
+	if (red != RTFI_MEAN && red != RTFI_MAX) {
+		PERROR("The reducer must be mean or max: %s\n", cl->reducer);
+		return -E_BADARGS;
+	}
+	if (!(cl->hop > 0 && cl->hop <= 1000)) {
+		PERROR("The hop must be between 0 and 1000 ms\n");
+		return -E_BADARGS;
+	}
+	if (rtfi_eq_octaves(&eq, cl->octave_db) != -E_OK) {
+		PERROR("Bad octave gains: %s\n", cl->octave_db);
+		return -E_BADARGS;
+	}
+	eq.highpass_hz = cl->highpass;
+	eq.shelf_hz = cl->shelf;
+	eq.shelf_db = cl->shelf_db;
+	if (arith == RTFI_Q31 && dec == RTFI_IIR) {
+		PERROR("The IIR decimator is not available in fixed point\n");
+		return -E_BADARGS;
+	}
+
+	rtfi_default_arith = arith;
+	rtfi_default_decimator = dec;
+	rtfi_default_align = align;
+	rtfi_default_hop_ms = cl->hop;
+	rtfi_default_max_hop_ms = cl->max_hop;
+	rtfi_default_reducer = red;
+	rtfi_default_eq = eq;
+	return -E_OK;
+}
+
+static int input_config(const struct cmdline *cl, struct rtfi_input_cfg *in)
+{ /* Fill in the PCM input configuration */
+	in->backend = RTFI_IN_PCM;
+	in->path = cl->input;
+	in->channels = cl->channels;
+	in->sample_rate = cl->rate;
+	in->realtime = cl->realtime;
+
+	if ((in->format = pcm_format(cl->format)) < 0) {
+		PERROR("Unknown sample format: %s\n", cl->format);
+		return -E_BADARGS;
+	}
+
+	return -E_OK;
+}
+
 int main(int argc, char *argv[])
 {
-	int r = 0, w, h, fs = 0;
-	void* client;
+	int r = 0;
+	void* client = NULL;
 	SDL_Surface *screen;
 	SDL_Surface *icon;
 	SDL_Thread *img_th;
 	sem_t sem;
 	struct start_param stp;
+	struct recorder *rec = NULL;
+	struct ff_reader replay;
+	struct player *player = NULL;
+	struct framebus bus, *busp = NULL;
+	int sample_rate, hop;
+	struct rtfi_input_cfg input = {RTFI_IN_JACK};
+	struct cmdline cl = {DEF_WIDTH, DEF_HEIGHT, 0, 0, NULL, 8, 0, NULL, 1, 0,
+				NULL, NULL, "s16", 1, 48000, 0, NULL, "float",
+				"fir", "none", BLK_SIZE_MS, 0, "mean",
+				0, 0, 0, ""};
+
+	if ((r = parse_cmdline(argc, argv, &cl)) < PARSE_OK) {
+		r = (r == -PARSE_REQHELP)? -E_DONEHELP : -E_BADARGS;
+		goto not_configured;
+	}
+
+	if (cl.input != NULL && (r = input_config(&cl, &input)) != -E_OK)
+		goto not_configured;
+
+	if ((r = select_kernels(cl.kernels)) != -E_OK
+	    || (r = select_filterbank(&cl)) != -E_OK)
+		goto not_configured;
+
+	memcpy(uicontrol.contrast, default_contrast, sizeof(default_contrast));
 
 	/* Semaphore init */
 	if (sem_init(&sem, 0, 0) != 0) {
@@ -106,27 +380,38 @@ int main(int argc, char *argv[])
 		goto sem_disaster;
 	}
 
-	/* RTFI initialization */
-	client = rtfi_prepare(&r, &sem);
-	if (client == NULL) {
-		r = -E_OTHER;
-		goto rtfi_disaster;
-	}
-
-	if (argc == 3) {
-		w = strtol(argv[1], NULL, 0);
-		h = strtol(argv[2], NULL, 0);
+	if (cl.play != NULL) {
+		/* Replay: frames come from the file, the engine is not used */
+		if ((r = ff_open(&replay, cl.play)) != -E_OK)
+			goto rtfi_disaster;
+		rtfi_set_output(&sem);
+		sample_rate = (int)replay.hdr->sample_rate;
+		hop = (int)replay.hdr->hop;
 	} else {
-		w = DEF_WIDTH;
-		h = DEF_HEIGHT;
-		if(argc == 2 && argv[1][0] == 'f') {
-			fs = 1;
-		} else if (argc != 1) {
-			printf("rtfi visualizer, by Juan I Carrano\n");
-			printf("Usage: %s [width height]\n", argv[0]);
-			printf("Fullscreen: %s f\n", argv[0]);
-			goto not_configured;
+		/* RTFI initialization */
+		client = rtfi_prepare(&r, &sem, &input);
+		if (client == NULL) {
+			r = -E_OTHER;
+			goto rtfi_disaster;
 		}
+		sample_rate = rtfi_samplerate();
+		hop = rtfi_hop();
+	}
+
+	if (cl.record != NULL) {
+		rec = recorder_open(cl.record, cl.rec_bits, cl.rec_delta,
+					sample_rate, hop, &r);
+		if (rec == NULL)
+			goto rec_disaster;
+		rtfi_add_queued_sink(recorder_push, recorder_room, rec);
+	}
+
+	if (cl.shm != NULL) {
+		if ((r = framebus_create(&bus, cl.shm, sample_rate, hop))
+								!= -E_OK)
+			goto bus_disaster;
+		busp = &bus;
+		rtfi_add_sink(framebus_push, busp);
 	}
 
 	SDL_Init(SDL_INIT_VIDEO|SDL_INIT_TIMER);
@@ -137,7 +422,7 @@ int main(int argc, char *argv[])
 		SDL_FreeSurface(icon);
 	}
 
-	if ((r = image_prepare(&screen, w, h, fs)) < 0)
+	if ((r = image_prepare(&screen, cl.w, cl.h, cl.fs)) < 0)
 		goto image_disaster;
 
 	stp.r = &r;
@@ -147,18 +432,50 @@ int main(int argc, char *argv[])
 	img_th = SDL_CreateThread(image_run, screen);
 
 	SDL_Delay(1000);
-	start_rtfi(0, &stp);
+	if (cl.play != NULL) {
+		player = player_start(&replay, ff_time2frame(&replay, cl.start),
+							cl.speed, &r);
+		if (player == NULL)
+			uicontrol.quit_requested = 1;
+	} else {
+		start_rtfi(0, &stp);
+	}
 	event_parser(NULL);
 	/* SDL_Delay(10000); */
 
+	if (player != NULL)
+		player_stop(player);
+	if (cl.play != NULL || cl.input != NULL) {
+		/* The input may have ended, and then nothing else will wake up
+		 * the image thread. Post one at a time, or it would think it is
+		 * lagging and keep waiting. */
+		while (uicontrol.running) {
+			if (rtfi_pending() == 0)
+				sem_post(&sem);
+			SDL_Delay(1);
+		}
+	}
+
 	SDL_WaitThread(img_th, NULL);
 
 image_disaster:
 	SDL_Quit();
-not_configured:
-	rtfi_unload(client);
+bus_disaster:
+rec_disaster:
+	if (client != NULL)
+		rtfi_unload(client);
+	if (cl.play != NULL)
+		ff_close(&replay);
+	/* the audio thread (or the player) is stopped, so it is safe to close
+	 * the recorder */
+	if (rec != NULL)
+		recorder_close(rec);
+	if (busp != NULL)
+		framebus_close(busp);
 rtfi_disaster:
+	sem_destroy(&sem);
 sem_disaster:
+not_configured:
 	return -r;
 }
 
@@ -192,136 +509,146 @@ static int image_prepare(SDL_Surface **screen, int w, int h, int fs)
 	return r;
 }
 
-static inline void putpixel(SDL_Surface *scr, int i, int j, struct RGB col)
-{
-	Uint32 Ucol = SDL_MapRGB(scr->format, col.r, col.g, col.b);
+static void build_palettes(Uint32 pal[][INTENSITY_LEVELS],
+				const SDL_PixelFormat *fmt,
+				const struct contrast *ct, unsigned int cmap)
+{ /* Compute, for each mode and intensity level, the pixel value that should be
+	shown on screen. */
+	struct RGB col[INTENSITY_LEVELS];
+	int m, i;
 
-	((Uint32 *)scr->pixels)[j*scr->pitch/4 + i] = Ucol;
-}
+	for (m = 0; m < N_MODES; m++) {
+		render_palette(col, m, &ct[m], cmap);
 
-static inline float dba(float x)
-{
-	return 20*log10f(x);
+		for (i = 0; i < INTENSITY_LEVELS; i++)
+			pal[m][i] = SDL_MapRGB(fmt, col[i].r, col[i].g,
+								col[i].b);
+	}
 }
 
-static inline float denorm0(float v,  float peak, float ths)
-{
-	float value = v - peak + ths;
-	return (value < ths)? ((value < 0) ? 0 : value) : ths;
-}
+static void present(SDL_Surface *screen, const Uint32 *pal,
+					const intensity_t *ibuf, int head)
+{ /* Convert the intensity buffer to pixels. "head" is the oldest column, which
+	goes to the left of the screen. */
+	const int W = screen->w, H = screen->h;
+	int y;
 
-static inline float denorm1(float v, float peak , float ths)
-{
-	return denorm0(v, peak, ths)/ths;
-}
+	if (SDL_MUSTLOCK(screen))
+		SDL_LockSurface(screen);
 
-static inline struct RGB gray(float v)
-{
-	return rgb(v, v, v);
-}
+	for (y = 0; y < H; y++) {
+		const intensity_t *src = ibuf + y*W;
+		Uint32 *dst = (Uint32 *)((Uint8 *)screen->pixels + y*screen->pitch);
 
-static inline struct RGB iris(float v)
-{
-	/* v between 0 and 1 */
-	/* float v = v; (pasthrough) */
-	/*float c = v * (1 - v) * (0.5 - v) * (0.5 - v) * 64;*/
-	/*float c = 4*v*(1-v)*((0.5 - v)*(0.5 - v) *11.6569 + 0.5);*/
-	float c = 6.75*v*v*v - 13.5 * v*v + 6.75 * v;
-	float h = ((v > 0.5)? (v - 1) : v) * 2 * M_PI;
-	return hcv2rgb(hcv(h, c, v*v));
-}
-
-static inline void pes(float *dst, float *src, int n)
-{
-	int i;
-
-	for (i = n - 1; i >= 0; i--) {
-		float acc = src[i];
-		int k;
-		for (k = 0; k < sizeof(hindex)/sizeof(*hindex)
-				&& i - hindex[k] >= 0; 	k++)
-			acc += src[i - hindex[k]];
-		dst[i] = acc / N_HARM;
+		kern->map32(dst, pal, src + head, W - head);
+		kern->map32(dst + W - head, pal, src, head);
 	}
+
+	if (SDL_MUSTLOCK(screen))
+		SDL_UnlockSurface(screen);
 }
 
+/* Everything that determines what is drawn in the intensity buffer */
+struct vparams {
+	int mode;
+	int baseb;
+	int span;
+	int fpool;
+	int tzoom;
+	int tplane;
+};
 
-static inline void spes(float *dst, float src[][REAL_N_BANDS], float *max, int n)
+static int vparams_eq(const struct vparams *a, const struct vparams *b)
 {
-	int i, t, f;
-	float m = -INFINITY;
-
-	for (f = 0; f < n; f++) {
-		float acc = 0, tmp;
-		for (t = 0; t < TIME_AVG; t++) {
-			for (i = (-FREQ_AVG)/2 + 1; i <= FREQ_AVG/2; i++) {
-				int fk = f + i;
-				if (fk >= 0 && fk < n)
-					acc += src[t][fk];
-			}
-		}
-		tmp = acc / (TIME_AVG * FREQ_AVG);
-		m = fmaxf(m, tmp);
-		dst[f] = tmp;
-	}
-	*max = m;
+	return a->mode == b->mode && a->baseb == b->baseb
+		&& a->span == b->span && a->fpool == b->fpool
+		&& a->tzoom == b->tzoom && a->tplane == b->tplane;
 }
 
-static inline void npes(float *dst, float *src, int n)
-{
-	int f;
-	float max = 0;
-
-	for (f = 0; f < n; f++) {
-		max = fmaxf(max, src[f]);
+static void rerender(struct pipeline *p, const struct history *hist,
+			const struct vparams *v, const struct resampler *rs,
+			unsigned long count, intensity_t *ibuf, int W, int H)
+{ /* Redraw the whole intensity buffer from the history level v->tzoom, so
+	that its rightmost column corresponds to entry number count - 1. The
+	entry n goes to column n % W. */
+	const unsigned long w = (unsigned long)W;
+	float db[HIST_NBANDS];
+	unsigned long n, first = (count >= w)? count - w : 0;
+	int x, y;
+
+	pipeline_reset(p);
+
+	/* warm up the time averaging */
+	for (n = (first >= TIME_AVG)? first - TIME_AVG : 0; n < first; n++) {
+		if (history_get(hist, v->tzoom, v->tplane, n, db) == -E_OK)
+			pipeline_step(p, db, v->mode);
 	}
-	for (f = 0; f < n; f++) {
-		dst[f] = src[f] - max;
+
+	for (x = 0; x < W; x++) {
+		/* if the history is shorter than the screen, the first columns
+		 * are left empty */
+		intensity_t *col = ibuf + (count + (unsigned long)x) % w;
+		int valid = (count + (unsigned long)x >= w);
+
+		n = count + (unsigned long)x - w;
+		if (valid && history_get(hist, v->tzoom, v->tplane, n, db)
+								== -E_OK) {
+			render_column(p, db, v->mode, rs, col, W);
+		} else {
+			for (y = 0; y < H; y++)
+				col[y*W] = 0;
+		}
 	}
 }
 
 static int image_run(SDL_Surface *screen)
 {
 	const int W = screen->w, H = screen->h;
-	float pesbuffer[TIME_AVG][REAL_N_BANDS];
-	unsigned int bufindex = 0, read_p = 0;
-	SDL_Surface *circ_buf;
-	int k = 0, aa = 0, i;
+	struct pipeline pipe;
+	struct history hist;
+	struct vparams shown = {-1, -1, -1, -1, -1, -1};
+	struct resampler rs = {0};
+	unsigned int read_p = 0;
+	intensity_t *ibuf;
+	Uint32 (*palette)[INTENSITY_LEVELS];
+	unsigned int style_gen;
+	/* number of entries of the shown history level already drawn, and
+	 * number of frames received up to the rightmost column */
+	unsigned long shown_count = 0, anchor = 0;
+	int aa = 0, restyled;
 	Uint32 last_time;
 	float dbmin = INFINITY, dbmax = -INFINITY;
 
+	uicontrol.span = H;
 	uicontrol.base_band = REAL_N_BANDS - H;
 
-	circ_buf = SDL_CreateRGBSurface(screen->flags, W, H,
-			screen->format->BitsPerPixel,
-			screen->format->Rmask,
-			screen->format->Gmask,
-			screen->format->Bmask,
-			screen->format->Amask);
+	if (NCALLOC(ibuf, (size_t)(W*H)) == NULL)
+		goto ibuf_disaster;
+	if (NMALLOC(palette, N_MODES) == NULL)
+		goto palette_disaster;
+	if (history_init(&hist, HIST_LEN, HIST_LEVEL_LEN) != -E_OK)
+		goto history_disaster;
 
-	SDL_FillRect(circ_buf, NULL, 0);
+	style_gen = uicontrol.style_gen;
+	build_palettes(palette, screen->format, uicontrol.contrast,
+							uicontrol.cmap);
+	restyled = 1;
 
 	read_p = ARTFI_DELAY - 1;
 
-	for (i = 0; i < TIME_AVG*REAL_N_BANDS; i++)
-		pesbuffer[0][i] = 0.0;
+	pipeline_reset(&pipe);
 
 	last_time = SDL_GetTicks();
 	uicontrol.running = 1;
 	while (!uicontrol.quit_requested) {
-		int read_valid = 0, y, f, retries = 0, dmode = uicontrol.mode;
-		int baseb = uicontrol.base_band, paused = uicontrol.paused;
-		float current[REAL_N_BANDS], spesbuf[REAL_N_BANDS], spesmax;
-		SDL_Rect marker_present;
-		SDL_Rect marker_present_ins = {0};
-		SDL_Rect marker_past;
+		int read_valid = 0, retries = 0, paused = uicontrol.paused;
+		struct vparams v = {(int)uicontrol.mode, uicontrol.base_band,
+					uicontrol.span, (int)uicontrol.fpool,
+					uicontrol.tzoom, (int)uicontrol.tplane};
+		float db[REAL_N_BANDS];
+		unsigned long count;
 		Uint32 tmp_time;
 
-		marker_present.h = marker_past.h = H;
-		marker_present_ins.y = marker_present.y = marker_past.y = 0;
-		marker_present.x = 0;
-
-
 		while (!read_valid){
 			int sv, i;
 
@@ -338,13 +665,10 @@ static int image_run(SDL_Surface *screen)
 			if (sv >= (ARTFI_DELAY - 1))
 				continue;
 
+			kern->db(db, rtfi_blocks[read_p], REAL_N_BANDS, 20);
 			for (i = 0; i < REAL_N_BANDS; i++) {
-				float tmp;
-				tmp = dba(rtfi_blocks[read_p][i]);
-				current[i] = denorm0(
-					(dmode > ARTFI)? (tmp - iso226[i]) : tmp,
-					PEAK_VALUE,
-					LOWER_THRS);
+				dbmax = fmaxf(db[i], dbmax);
+				dbmin = fminf(db[i], dbmin);
 			}
 
 			sem_getvalue(block_lock, &sv);
@@ -360,64 +684,51 @@ static int image_run(SDL_Surface *screen)
 			dbmax = -INFINITY;
 		}
 
-		marker_present.w = k + 1;
-		marker_past.x = k + 1;
-		marker_present_ins.x = marker_past.w = W - k - 1;
-
+		history_push(&hist, db);
+		count = history_count(&hist, v.tzoom);
 		if (!paused)
-		{
-		pes(pesbuffer[bufindex], current, REAL_N_BANDS);
-		spes(spesbuf, pesbuffer, &spesmax, REAL_N_BANDS);
-	/*	if (dmode == NPES)
-			npes(spesbuf, spesbuf, REAL_N_BANDS);
-	*/
-		for (y = 0; y < H ; y++)
-		{
-			float tmp;
-			float c;
-			if ((f = y + baseb)< REAL_N_BANDS) {
-				switch (dmode) {
-				default:
-				case NPES:
-					c = denorm1(spesbuf[f], spesmax, 8);
-					break;
-				case SPES:
-					c = denorm1(spesbuf[f], 40, 40);
-					break;
-				case PES:
-					c = denorm1(pesbuffer[bufindex][f], 55, 50);
-					break;
-				case AES:
-				case ARTFI:
-					c = current[f]/LOWER_THRS;
+			anchor = history_count(&hist, 0);
+
+		if (!vparams_eq(&v, &shown)
+		    || (!paused && count != shown_count
+				&& count != shown_count + 1)) {
+			/* The view changed, or we are coming back from a
+			 * pause: redraw everything from the history */
+			if (v.baseb != shown.baseb || v.span != shown.span
+			    || v.fpool != shown.fpool) {
+				resampler_free(&rs);
+				if (resampler_init(&rs, H, REAL_N_BANDS, v.baseb,
+						v.span, v.fpool) != -E_OK) {
+					uicontrol.quit_requested = 1;
 					break;
 				}
-			} else {
-				c = 0;
 			}
-
-			tmp = spesbuf[f];
-			/*tmp = pesbuffer[bufindex][f];*/
-			/* */
-			dbmax = fmaxf(tmp, dbmax);
-			dbmin = fminf(tmp, dbmin);
-			putpixel(circ_buf, k, y, iris(c));
+			shown_count = anchor >> v.tzoom;
+			rerender(&pipe, &hist, &v, &rs, shown_count, ibuf, W, H);
+			shown = v;
+			restyled = 1;
+		} else if (!paused && count == shown_count + 1) {
+			/* at zoomed-out levels, most frames do not complete
+			 * a new column */
+			history_get(&hist, v.tzoom, v.tplane, shown_count, db);
+			render_column(&pipe, db, v.mode, &rs,
+				ibuf + shown_count % (unsigned long)W, W);
+			shown_count = count;
 		}
 
-		INCMOD(bufindex, TIME_AVG);
-
-		k++;
-		if (k >= W) {
-			k = 0;
-		}
+		if (uicontrol.style_gen != style_gen) {
+			style_gen = uicontrol.style_gen;
+			build_palettes(palette, screen->format,
+					uicontrol.contrast, uicontrol.cmap);
+			restyled = 1;
 		}
+
 		tmp_time = SDL_GetTicks();
 		if (tmp_time - last_time >= MIN_REFRESH_TIME) {
-			if (!paused) {
-			SDL_BlitSurface(circ_buf, &marker_present, screen,
-							&marker_present_ins);
-			SDL_BlitSurface(circ_buf, &marker_past, screen,
-							&marker_present);
+			if (!paused || restyled) {
+				present(screen, palette[shown.mode], ibuf,
+					(int)(shown_count % (unsigned long)W));
+				restyled = 0;
 			}
 			last_time = tmp_time;
 			SDL_Flip(screen);
@@ -427,7 +738,20 @@ static int image_run(SDL_Surface *screen)
 	}
 	uicontrol.running = 0;
 
+	resampler_free(&rs);
+	history_free(&hist);
+	free(palette);
+	free(ibuf);
+
 	return 0;
+
+history_disaster:
+	free(palette);
+palette_disaster:
+	free(ibuf);
+ibuf_disaster:
+	uicontrol.quit_requested = 1;
+	return -E_NOMEM;
 }
 
 static int event_parser(void *data)
@@ -440,6 +764,9 @@ static int event_parser(void *data)
 			uicontrol.quit_requested = 1;
 		} else if (ev.type == SDL_KEYDOWN) {
 			int ref_delta = 0, new_ref, mode_changed = 0;
+			int span = uicontrol.span, lo, hi;
+			int peak_delta = 0, range_delta = 0, ct_delta;
+			struct contrast *ct = &uicontrol.contrast[uicontrol.mode];
 
 			switch (ev.key.keysym.sym) {
 			case REFLEVEL_PLUS:
@@ -459,6 +786,48 @@ static int event_parser(void *data)
 				DECMOD(uicontrol.mode, N_MODES);
 				mode_changed = 1;
 				break;
+			case PEAK_PLUS:
+				peak_delta = 1;
+				break;
+			case PEAK_MINUS:
+				peak_delta = -1;
+				break;
+			case RANGE_PLUS:
+				range_delta = 1;
+				break;
+			case RANGE_MINUS:
+				range_delta = -1;
+				break;
+			case CMAP_NEXT:
+				INCMOD(uicontrol.cmap, N_CMAPS);
+				uicontrol.style_gen++;
+				break;
+			case TZOOM_OUT:
+			case SDLK_KP_MINUS:
+				if (uicontrol.tzoom < HIST_LEVELS)
+					uicontrol.tzoom++;
+				break;
+			case TZOOM_IN:
+			case SDLK_KP_PLUS:
+				if (uicontrol.tzoom > 0)
+					uicontrol.tzoom--;
+				break;
+			case TPLANE_NEXT:
+				INCMOD(uicontrol.tplane, HIST_N_PLANES);
+				break;
+			case FZOOM_IN:
+				span = (span / 2 > MIN_SPAN)? span / 2 : MIN_SPAN;
+				break;
+			case FZOOM_OUT:
+				span = (span * 2 < REAL_N_BANDS)? span * 2
+							: REAL_N_BANDS;
+				break;
+			case FZOOM_FIT:
+				span = REAL_N_BANDS;
+				break;
+			case FPOOL_NEXT:
+				INCMOD(uicontrol.fpool, RS_N_POOL);
+				break;
 			default:
 				continue;
 			}
@@ -469,17 +838,35 @@ static int event_parser(void *data)
 						modenames[uicontrol.mode]);
 			}
 
-			if (ev.key.keysym.mod & REFLEVEL_ACCEL)
+			if (ev.key.keysym.mod & REFLEVEL_ACCEL) {
 				ref_delta = ref_delta * ACCEL_AMOUNT;
-			else
+				ct_delta = ACCEL_CONTRAST;
+			} else {
 				ref_delta = ref_delta * NO_ACCEL_AMOUNT;
+				ct_delta = NO_ACCEL_CONTRAST;
+			}
+
+			if (peak_delta || range_delta) {
+				ct->peak += (float)(peak_delta * ct_delta);
+				ct->range = fmaxf(ct->range
+					+ (float)(range_delta * ct_delta), MIN_RANGE);
+				PDEBUG("%s: peak %f, range %f\n",
+					modenames[uicontrol.mode], ct->peak,
+					ct->range);
+				uicontrol.style_gen++;
+			}
 
-			new_ref = uicontrol.base_band + ref_delta;
-			uicontrol.base_band = (new_ref > 0)?
-						((new_ref < REAL_N_BANDS)?
-							new_ref
-							: N_BANDS - 1)
-						: 0;
+			/* zoom around the center of the screen */
+			new_ref = uicontrol.base_band + (uicontrol.span - span)/2
+								+ ref_delta;
+			/* if the span is more than all the bands, allow some
+			 * space on either side */
+			lo = (REAL_N_BANDS - span < 0)? REAL_N_BANDS - span : 0;
+			hi = (REAL_N_BANDS - span > 0)? REAL_N_BANDS - span : 0;
+			uicontrol.base_band = (new_ref > lo)?
+						((new_ref < hi)? new_ref : hi)
+						: lo;
+			uicontrol.span = span;
 		}
 	}
 
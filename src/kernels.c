@@ -0,0 +1,444 @@
+/*
+ * kernels.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+/* Kernels, see kernels.h. Compiled on its own this gives the baseline
+ * variant; kernels_avx2.c and kernels_avx512.c include it after selecting
+ * their instruction set, with KERNEL_ISA set to the name of the variant.
+ * The kernels that depend on the filterbank configuration are generated
+ * (src_generated/rtfi_kernels.c) and included here.
+ *
+ * Sums are done in the same order as a straightforward loop would, but
+ * with the independent outputs in the inner loop, which is what allows the
+ * compiler to vectorize them. */
+
+#include <math.h>
+#include <string.h>
+#include "../src_generated/rtfi_defines.h"
+#include "kernels.h"
+#include "../src_generated/rtfi_kernels.c"
+
+#ifndef KERNEL_ISA
+#define KERNEL_ISA base
+#endif
+
+#define KERNEL_CAT_(a, b) a ## b
+#define KERNEL_CAT(a, b) KERNEL_CAT_(a, b)
+#define KERNEL_STR_(a) #a
+#define KERNEL_STR(a) KERNEL_STR_(a)
+
+static void decimate(const float *restrict h, const float *restrict src,
+					int j0, int n, float *restrict dst)
+{ /* For each output, the taps are added in order, as in
+	acc += h[i] * (src[j - i] + src[j + i - (DFILTER_N - 1)]) */
+	const int o0 = j0 / 2, o1 = (n + 1) / 2;
+	int i, o;
+
+	for (o = o0; o < o1; o++)
+		dst[o] = 0;
+
+	for (i = 0; i < DFILTER_N / 2; i++) {
+		for (o = o0; o < o1; o++)
+			dst[o] += h[i] * (src[2*o - i]
+					  + src[2*o + i - (DFILTER_N - 1)]);
+	}
+}
+
+static void decimate_iir(const float *restrict a, float *restrict x1,
+		float *restrict y1, const float *restrict src, int n,
+		float *restrict dst)
+{ /* The odd samples go through the sections a[0], a[2], ... and the even
+	ones through a[1], a[3], ... At the output rate each section is
+	y = a*(x - y1) + x1. */
+	int i, o;
+
+	for (o = 0; o < n / 2; o++) {
+		float s[2] = {src[2*o + 1], src[2*o]};
+
+		for (i = 0; i < APF_N; i++) {
+			float y = a[i] * (s[i % 2] - y1[i]) + x1[i];
+
+			x1[i] = s[i % 2];
+			y1[i] = y;
+			s[i % 2] = y;
+		}
+
+		dst[o] = 0.5f * (s[0] + s[1]);
+	}
+}
+
+static void resonate_ext(const float *restrict ar, const float *restrict ai,
+		const float *restrict k, float *restrict yr, float *restrict yi,
+		const float *restrict src, int n, int lo, float *restrict acc,
+		float *restrict peak, float *restrict cr, float *restrict ci)
+{ /* resonate_block from band lo, with the other outputs. acc is summed
+	exactly as there. */
+	int i, b;
+
+	for (b = lo; b < BLOCK; b++) {
+		acc[b] = 0;
+		peak[b] = 0;
+		cr[b] = 0;
+		ci[b] = 0;
+	}
+
+	for (i = 0; i < n; i++) {
+		const float x = src[i];
+
+		for (b = lo; b < BLOCK; b++) {
+			float re = k[b]*x + (ar[b]*yr[b] - ai[b]*yi[b]);
+			float im = ar[b]*yi[b] + ai[b]*yr[b];
+			float p = re*re + im*im;
+
+			cr[b] += re*yr[b] + im*yi[b];
+			ci[b] += im*yr[b] - re*yi[b];
+			yr[b] = re;
+			yi[b] = im;
+			acc[b] += p;
+			peak[b] = (p > peak[b])? p : peak[b];
+		}
+	}
+}
+
+static void biquads(const float (*c)[5], float (*z)[2], int nq,
+				const float *src, int n, float *dst)
+{ /* y = b0*x + z0, z0 = b1*x - a1*y + z1, z1 = b2*x - a2*y */
+	int i, j;
+
+	for (i = 0; i < n; i++) {
+		float x = src[i];
+
+		for (j = 0; j < nq; j++) {
+			const float y = c[j][0] * x + z[j][0];
+
+			z[j][0] = c[j][1] * x - c[j][3] * y + z[j][1];
+			z[j][1] = c[j][2] * x - c[j][4] * y;
+			x = y;
+		}
+
+		dst[i] = x;
+	}
+}
+
+static inline int64_t sat31(int64_t v)
+{ /* Symmetric, so that |v|^2 fits in 62 bits */
+	return (v > INT32_MAX)? INT32_MAX : (v < -INT32_MAX)? -INT32_MAX : v;
+}
+
+static void to_q31(int32_t *restrict dst, const float *restrict src, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		float v = src[i] * 2147483648.0f;
+
+		dst[i] = (v >= 2147483648.0f)? INT32_MAX
+			: (v <= -2147483648.0f)? -INT32_MAX : (int32_t)v;
+	}
+}
+
+static void biquads_q31(const int32_t (*c)[5], const int *shift,
+			int32_t (*z)[5], int nq, int32_t *x, int n)
+{ /* Direct form I, one section at a time. The coefficients are below 2^29
+	after scaling, so the five products add up in 64 bits. */
+	int i, j;
+
+	for (j = 0; j < nq; j++) {
+		const int64_t mask = ((int64_t)1 << shift[j]) - 1;
+		int32_t x1 = z[j][0], x2 = z[j][1], y1 = z[j][2], y2 = z[j][3];
+		int64_t err = z[j][4];
+
+		for (i = 0; i < n; i++) {
+			const int64_t acc = (int64_t)c[j][0]*x[i]
+				+ (int64_t)c[j][1]*x1 + (int64_t)c[j][2]*x2
+				- (int64_t)c[j][3]*y1 - (int64_t)c[j][4]*y2
+				+ err;
+
+			err = acc & mask;
+			x2 = x1;
+			x1 = x[i];
+			y2 = y1;
+			y1 = (int32_t)sat31(acc >> shift[j]);
+			x[i] = y1;
+		}
+
+		z[j][0] = x1;
+		z[j][1] = x2;
+		z[j][2] = y1;
+		z[j][3] = y2;
+		z[j][4] = (int32_t)err;
+	}
+}
+
+static void decimate_q31(const int32_t *restrict h,
+		const int32_t *restrict src, int n, int32_t *restrict dst)
+{ /* The sum of |h| over half the filter is less than one, so the
+	accumulator cannot overflow. */
+	int i, o;
+
+	for (o = 0; o < (n + 1) / 2; o++) {
+		int64_t acc = (int64_t)1 << 30;
+
+		for (i = 0; i < DFILTER_N / 2; i++)
+			acc += (int64_t)h[i] * ((int64_t)src[2*o - i]
+					+ src[2*o + i - (DFILTER_N - 1)]);
+
+		dst[o] = (int32_t)sat31(acc >> 31);
+	}
+}
+
+static inline void resonate_q31_loop(const int32_t *restrict ar,
+		const int32_t *restrict ai, const int32_t *restrict k,
+		int32_t *restrict yr, int32_t *restrict yi,
+		int32_t *restrict er, int32_t *restrict ei,
+		const int32_t *restrict src, int n, int lo,
+		struct q31_acc *restrict acc, const int ext)
+{ /* |a1| < 1, so ar*yr - ai*yi fits in 62 bits plus sign, with room for
+	k*x and the error. |y|^2 and y[n] conj(y[n-1]) fit in 63 bits; their
+	top and bottom 32 bits are summed apart, which is exact for 2^31
+	samples and needs no carries. */
+	int64_t *restrict ph = acc->p_hi, *restrict pl = acc->p_lo;
+	int64_t *restrict xrh = acc->xr_hi, *restrict xrl = acc->xr_lo;
+	int64_t *restrict xih = acc->xi_hi, *restrict xil = acc->xi_lo;
+	int64_t *restrict pk = acc->peak;
+	int i, b;
+
+	for (i = 0; i < n; i++) {
+		const int64_t x = src[i];
+
+		for (b = lo; b < BLOCK; b++) {
+			int64_t re = k[b]*x + (int64_t)ar[b]*yr[b]
+					- (int64_t)ai[b]*yi[b] + er[b];
+			int64_t im = (int64_t)ar[b]*yi[b]
+					+ (int64_t)ai[b]*yr[b] + ei[b];
+			int64_t r = sat31(re >> 31), m = sat31(im >> 31);
+			int64_t pw = r*r + m*m;
+
+			er[b] = re & INT32_MAX;
+			ei[b] = im & INT32_MAX;
+			ph[b] += pw >> 32;
+			pl[b] += pw & UINT32_MAX;
+			if (ext) {
+				int64_t vr = r*yr[b] + m*yi[b];
+				int64_t vi = m*yr[b] - r*yi[b];
+
+				pk[b] = (pw > pk[b])? pw : pk[b];
+				xrh[b] += vr >> 32;
+				xrl[b] += vr & UINT32_MAX;
+				xih[b] += vi >> 32;
+				xil[b] += vi & UINT32_MAX;
+			}
+			yr[b] = (int32_t)r;
+			yi[b] = (int32_t)m;
+		}
+	}
+}
+
+static void resonate_q31(const int32_t *restrict ar,
+		const int32_t *restrict ai, const int32_t *restrict k,
+		int32_t *restrict yr, int32_t *restrict yi,
+		int32_t *restrict er, int32_t *restrict ei,
+		const int32_t *restrict src, int n, int lo, int ext,
+						struct q31_acc *restrict acc)
+{ /* Each case gets its own loop, without the test inside */
+	if (ext)
+		resonate_q31_loop(ar, ai, k, yr, yi, er, ei, src, n, lo, acc,
+									1);
+	else
+		resonate_q31_loop(ar, ai, k, yr, yi, er, ei, src, n, lo, acc,
+									0);
+}
+
+/* log2(1 + t) / t for t in [-0.25, 0.5), fitted for the least maximum error
+ * of log2(1 + t): 1.2e-4, which is 0.0007 dB in 20 log10 (0.0008 dB with
+ * the rounding of the float operations) */
+#define LOG2_C1 1.44250051f
+#define LOG2_C2 -0.72827190f
+#define LOG2_C3 0.49645546f
+#define LOG2_C4 -0.26224926f
+
+static void db(float *dst, const float *src, int n, float scale)
+{ /* The exponent is taken from the bits of the float, rounded so that the
+	mantissa is in [0.75, 1.5) and the polynomial is near zero for values
+	near powers of two. Subnormals are taken as FLT_MIN, zero (or less)
+	gives -INFINITY and NaNs are taken as INFINITY, so that the exponent
+	arithmetic cannot overflow. The selects are on integers or constants, so that the
+	loop can be vectorized. */
+	const float s = scale * 0.301029995663981195f; /* log10(2) */
+	const int32_t fmin = 0x00800000; /* bits of FLT_MIN */
+	const int32_t finf = 0x7f800000; /* bits of INFINITY */
+	int i;
+
+	for (i = 0; i < n; i++) {
+		int32_t v, u, e;
+		float t;
+
+		memcpy(&v, src + i, sizeof(v));
+		u = (v < fmin)? fmin : (v > finf)? finf : v;
+		e = ((u + 0x00400000) >> 23) - 127;
+		u -= e * (1 << 23);
+		memcpy(&t, &u, sizeof(t));
+		t -= 1;
+		dst[i] = s * ((float)e + t*(LOG2_C1 + t*(LOG2_C2
+					+ t*(LOG2_C3 + t*LOG2_C4))))
+			+ ((v > 0)? 0 : -INFINITY);
+	}
+}
+
+static void iso(float *restrict dst, const float *restrict src, int n,
+			const float *restrict w, int rows, int cols, float offset)
+{ /* The level is clamped with selects and both rows are always read, so
+	that the loop vectorizes with the lookups as gathers. */
+	const float top = (float)(rows - 1);
+	int i;
+
+	for (i = 0; i < n; i++) {
+		const float l0 = src[i] + offset;
+		const float l = (l0 < 0)? 0 : (l0 > top)? top : l0;
+		const int row = (l < top)? (int)l : rows - 2;
+		const float fl = l - (float)row;
+		const float fc = (float)(i % FXST) * (1.0f / FXST);
+		const int k0 = row * cols + i / FXST, k1 = k0 + cols;
+
+		dst[i] = src[i] - ((1 - fl) * (w[k0] + fc * (w[k0 + 1] - w[k0]))
+				+ fl * (w[k1] + fc * (w[k1 + 1] - w[k1])));
+	}
+}
+
+static void pes(float *restrict dst, const float *restrict src, int n,
+						const int *hi, int nh)
+{
+	int i, k;
+
+	for (i = 0; i < n; i++)
+		dst[i] = src[i];
+
+	for (k = 0; k < nh; k++) {
+		for (i = hi[k]; i < n; i++)
+			dst[i] += src[i - hi[k]];
+	}
+
+	for (i = 0; i < n; i++)
+		dst[i] /= (float)(nh + 1);
+}
+
+/* Bands averaged around each one: f + SPES_LO to f + SPES_HI */
+#define SPES_LO ((-FREQ_AVG)/2 + 1)
+#define SPES_HI (FREQ_AVG/2)
+
+static inline float spes_edge(const float *src, int stride, int n, int f)
+{ /* The bands near the ends, where some neighbours are missing */
+	float acc = 0;
+	int t, i;
+
+	for (t = 0; t < TIME_AVG; t++) {
+		for (i = SPES_LO; i <= SPES_HI; i++) {
+			if (f + i >= 0 && f + i < n)
+				acc += src[t*stride + f + i];
+		}
+	}
+
+	return acc;
+}
+
+static float spes(float *restrict dst, const float *restrict src, int stride,
+									int n)
+{
+	const int f0 = (-SPES_LO < n)? -SPES_LO : n;
+	const int f1 = (n - SPES_HI > f0)? n - SPES_HI : f0;
+	float m = -INFINITY;
+	int f, t, i;
+
+	for (f = f0; f < f1; f++)
+		dst[f] = 0;
+
+	for (t = 0; t < TIME_AVG; t++) {
+		for (i = SPES_LO; i <= SPES_HI; i++) {
+			const float *s = src + t*stride + i;
+
+			for (f = f0; f < f1; f++)
+				dst[f] += s[f];
+		}
+	}
+
+	for (f = 0; f < f0; f++)
+		dst[f] = spes_edge(src, stride, n, f);
+	for (f = f1; f < n; f++)
+		dst[f] = spes_edge(src, stride, n, f);
+
+	for (f = 0; f < n; f++) {
+		dst[f] /= TIME_AVG * FREQ_AVG;
+		m = fmaxf(m, dst[f]);
+	}
+
+	return m;
+}
+
+static void resample_mean(float *restrict dst, const float *restrict src,
+		const int *restrict band, const float *restrict weight, int n)
+{
+	int y;
+
+	for (y = 0; y < n; y++)
+		dst[y] += weight[y] * src[band[y]];
+}
+
+static void resample_max(float *restrict dst, const float *restrict src,
+					const int *restrict band, int n)
+{ /* Not fmaxf, which does not vectorize. The levels are never NaN. */
+	int y;
+
+	for (y = 0; y < n; y++) {
+		float v = src[band[y]];
+
+		dst[y] = (v > dst[y])? v : dst[y];
+	}
+}
+
+static void map32(uint32_t *restrict dst, const uint32_t *restrict pal,
+				const intensity_t *restrict src, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		dst[i] = pal[src[i]];
+}
+
+const struct kernels KERNEL_CAT(kernels_, KERNEL_ISA) = {
+	.name = KERNEL_STR(KERNEL_ISA),
+	.decimate = decimate,
+	.decimate_cfg = RTFI_DECIMATE_CONFIGS,
+	.decimate_iir = decimate_iir,
+	.resonate_block = resonate_block,
+	.resonate_bottom = resonate_bottom,
+	.resonate_ext = resonate_ext,
+	.biquads = biquads,
+	.db = db,
+	.iso = iso,
+	.to_q31 = to_q31,
+	.biquads_q31 = biquads_q31,
+	.decimate_q31 = decimate_q31,
+	.resonate_q31 = resonate_q31,
+	.pes = pes,
+	.spes = spes,
+	.resample_mean = resample_mean,
+	.resample_max = resample_max,
+	.map32 = map32,
+};
@@ -0,0 +1,170 @@
+/*
+ * kernels.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _KERNELS_H_
+#define _KERNELS_H_
+
+#include <stdint.h>
+#include "render.h"
+
+/* The inner loops of the filterbank and of the image pipeline, compiled once
+ * for each instruction set (kernels.c is the source of all of them). The best
+ * variant the processor supports is picked when the program starts, so one
+ * build runs everywhere without -march=native.
+ *
+ * All the variants give exactly the same results: the loops are arranged so
+ * that they can be vectorized without reordering any sum. */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNELS_X86
+#endif
+
+/* Sums of the fixed point resonators over a hop, kept exactly in integers:
+ * |y|^2 and y[n] conj(y[n-1]) (real and imaginary parts) in Q62, as hi * 2^32
+ * + lo, and the largest |y|^2. */
+struct q31_acc {
+	int64_t p_hi[BLOCK], p_lo[BLOCK], peak[BLOCK];
+	int64_t xr_hi[BLOCK], xr_lo[BLOCK], xi_hi[BLOCK], xi_lo[BLOCK];
+};
+
+struct kernels {
+	const char *name;
+
+	/* Decimating FIR: for each even j in [j0, n), dst[j/2] is the output of
+	 * the symmetric filter whose first half is h (DFILTER_N/2 taps) at
+	 * src[j]. src[j0 - DFILTER_N + 1] must be valid. */
+	void (*decimate)(const float *h, const float *src, int j0, int n,
+								float *dst);
+
+	/* The same for the filter of each built-in configuration, indexed by
+	 * its position in RTFI_SAMPLERATES. These are generated by rtfi.py,
+	 * with the taps unrolled and the coefficients as constants. */
+	void (*decimate_cfg[RTFI_N_CONFIGS])(const float *src, int j0, int n,
+								float *dst);
+
+	/* Allpass half-band decimator (RTFI_IIR): dst[j/2] for each even j in
+	 * [0, n), n even. a has the APF_N coefficients, x1 and y1 the last
+	 * input and output of each section. */
+	void (*decimate_iir)(const float *a, float *x1, float *y1,
+				const float *src, int n, float *dst);
+
+	/* Run the resonators y = k*x + a1*y of a block over n samples of src.
+	 * a1 and y are split in real and imaginary parts. acc gets the sum of
+	 * |y|^2 of each one. The bottom octave only has the bands from
+	 * BOTTOM_MINIDEX to BLOCK. Also generated. */
+	void (*resonate_block)(const float *ar, const float *ai,
+			const float *k, float *yr, float *yi, const float *src,
+							int n, float *acc);
+	void (*resonate_bottom)(const float *ar, const float *ai,
+			const float *k, float *yr, float *yi, const float *src,
+							int n, float *acc);
+
+	/* The same for the bands lo to BLOCK, also with the maximum of |y|^2
+	 * of each one in peak (for RTFI_MAX) and the sum of y[n] conj(y[n-1])
+	 * in cr, ci (for RTFI_FREQ). Not generated. */
+	void (*resonate_ext)(const float *ar, const float *ai,
+			const float *k, float *yr, float *yi, const float *src,
+			int n, int lo, float *acc, float *peak, float *cr,
+								float *ci);
+
+	/* Cascade of nq biquads over n samples, for the input equalizer. Each
+	 * section has the coefficients b0, b1, b2, a1, a2 (a0 is 1) and the
+	 * state of the transposed direct form II. src may be dst. */
+	void (*biquads)(const float (*c)[5], float (*z)[2], int nq,
+					const float *src, int n, float *dst);
+
+	/* dst[i] = scale * log10(src[i]) for n powers (-INFINITY for 0),
+	 * within 0.001 dB for scale 20 (0.0005 dB for 10). Computed from
+	 * the exponent and a polynomial instead of log10f, which is most of
+	 * the cost of a frame outside of the filterbank. src may be dst. */
+	void (*db)(float *dst, const float *src, int n, float scale);
+
+	/* Equal loudness: dst[i] is src[i] (dB) minus the weight of band i at
+	 * the level src[i] + offset, interpolated between the rows of w (one
+	 * per dB, rows of them, cols floats apart) and its columns (one per
+	 * FXST bands). Levels beyond w get its first or last row. */
+	void (*iso)(float *dst, const float *src, int n, const float *w,
+					int rows, int cols, float offset);
+
+	/* Fixed point (Q31) versions, for RTFI_ARITH_Q31 (see engine.h).
+	 *
+	 * to_q31 converts samples in [-1, 1] to Q31, saturating. */
+	void (*to_q31)(int32_t *dst, const float *src, int n);
+
+	/* The equalizer, in place. Each section has the coefficients b0, b1,
+	 * b2, a1, a2 scaled by 2^shift, and z holds x[n-1], x[n-2], y[n-1],
+	 * y[n-2] and the truncation error, which is fed back like in the
+	 * resonators. */
+	void (*biquads_q31)(const int32_t (*c)[5], const int *shift,
+				int32_t (*z)[5], int nq, int32_t *x, int n);
+
+	/* The decimating FIR for j0 = 0, accumulated in 64 bits and rounded.
+	 * src[-DFILTER_N + 1] must be valid. */
+	void (*decimate_q31)(const int32_t *h, const int32_t *src, int n,
+								int32_t *dst);
+
+	/* The resonators of the bands lo to BLOCK. The truncation error of
+	 * each output is kept in er, ei and added to the next one (error
+	 * feedback), so it does not build up in the slowly decaying poles.
+	 * The sums are added to acc; the peak and y[n] conj(y[n-1]) only if
+	 * ext is set. */
+	void (*resonate_q31)(const int32_t *ar, const int32_t *ai,
+			const int32_t *k, int32_t *yr, int32_t *yi, int32_t *er,
+			int32_t *ei, const int32_t *src, int n, int lo, int ext,
+							struct q31_acc *acc);
+
+	/* Harmonic sum: dst[i] is the mean of src[i] and src[i - hi[k]]
+	 * (those that exist), hi has nh increasing offsets. */
+	void (*pes)(float *dst, const float *src, int n, const int *hi,
+									int nh);
+
+	/* Smoothed PES: the mean over TIME_AVG rows of src (stride floats
+	 * apart) and FREQ_AVG neighbouring bands. Returns the maximum. */
+	float (*spes)(float *dst, const float *src, int stride, int n);
+
+	/* One tap of a resampler (see resample.h) for n rows: dst[y] +=
+	 * weight[y] * src[band[y]] for the mean, and the greater of dst[y]
+	 * and src[band[y]] for the maximum. */
+	void (*resample_mean)(float *dst, const float *src, const int *band,
+						const float *weight, int n);
+	void (*resample_max)(float *dst, const float *src, const int *band,
+									int n);
+
+	/* Palette lookup, for the screen */
+	void (*map32)(uint32_t *dst, const uint32_t *pal,
+					const intensity_t *src, int n);
+};
+
+extern const struct kernels kernels_base;
+#ifdef KERNELS_X86
+extern const struct kernels kernels_avx2, kernels_avx512;
+#endif
+
+/* The variant in use */
+extern const struct kernels *kern;
+
+/* Use the kernels with this name ("base", "avx2", "avx512"), or the best
+ * ones for this processor if name is NULL or "auto". Returns -E_BADARGS for
+ * an unknown name and -E_BADCFG if the processor does not support them.
+ * Call before starting any thread. */
+extern int kernels_select(const char *name);
+
+#endif /* _KERNELS_H_ */
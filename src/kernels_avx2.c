@@ -0,0 +1,31 @@
+/*
+ * kernels_avx2.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+/* The kernels for processors with AVX2 and FMA. Only used if the processor
+ * supports them (see dispatch.c), so nothing else may be built this way. */
+
+#include "kernels.h"
+
+#ifdef KERNELS_X86
+#pragma GCC target("avx2,fma")
+#define KERNEL_ISA avx2
+#include "kernels.c"
+#endif /* KERNELS_X86 */
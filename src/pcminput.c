@@ -0,0 +1,256 @@
+/*
+ * pcminput.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <libjc/common.h>
+#include "rtfi.h"
+#include "pcminput.h"
+
+/* How often a blocked read checks if it must stop, in ms */
+#define PCM_POLL_MS 100
+
+static const struct {
+	const char *name;
+	int size;
+} formats[N_PCM_FORMATS] = {
+	[PCM_S16] = {"s16", 2},
+	[PCM_S32] = {"s32", 4},
+	[PCM_F32] = {"f32", 4},
+};
+
+struct pcm_input {
+	int fd;
+	int format, channels, realtime;
+	int sample_rate;
+	unsigned char *raw;
+	float block[PCM_BLOCK];
+	int stop, started;
+	pthread_t thread;
+};
+
+int pcm_format(const char *name)
+{
+	int i;
+
+	for (i = 0; i < N_PCM_FORMATS; i++)
+		if (strcmp(name, formats[i].name) == 0)
+			return i;
+
+	return -1;
+}
+
+static int stopped(struct pcm_input *in)
+{
+	return __atomic_load_n(&in->stop, __ATOMIC_ACQUIRE);
+}
+
+static size_t read_block(struct pcm_input *in, size_t len)
+{ /* Read up to len bytes. Returns less only at the end of the stream. */
+	struct pollfd pfd = {in->fd, POLLIN, 0};
+	size_t got = 0;
+
+	while (got < len && !stopped(in)) {
+		ssize_t n;
+
+		if (poll(&pfd, 1, PCM_POLL_MS) <= 0)
+			continue;
+		if ((n = read(in->fd, in->raw + got, len - got)) <= 0)
+			break;
+		got += (size_t)n;
+	}
+
+	return got;
+}
+
+int pcm_sample_size(int format)
+{
+	return formats[format].size;
+}
+
+void pcm_to_mono(const void *raw, int format, int channels, float *dst,
+								int n)
+{
+	const float scale = 1.0f / (float)channels;
+	int i, c;
+
+	for (i = 0; i < n; i++) {
+		float acc = 0;
+
+		for (c = 0; c < channels; c++) {
+			size_t j = (size_t)i * (size_t)channels + (size_t)c;
+
+			switch (format) {
+			case PCM_S16:
+				acc += ((const int16_t *)raw)[j]
+							* (1.0f / 32768);
+				break;
+			case PCM_S32:
+				acc += (float)((const int32_t *)raw)[j]
+							* (1.0f / 2147483648.0f);
+				break;
+			default:
+				acc += ((const float *)raw)[j];
+				break;
+			}
+		}
+		dst[i] = acc * scale;
+	}
+}
+
+static void convert(struct pcm_input *in, int n)
+{ /* Convert n frames (of all channels) to mono floats in in->block */
+	int i;
+
+	pcm_to_mono(in->raw, in->format, in->channels, in->block, n);
+
+	/* pad the last block with silence */
+	for (i = n; i < PCM_BLOCK; i++)
+		in->block[i] = 0;
+}
+
+static void *pcm_run(void *arg)
+{
+	struct pcm_input *in = arg;
+	const size_t frame_size = (size_t)formats[in->format].size
+						* (size_t)in->channels;
+	const int64_t period = (int64_t)1000000000 * PCM_BLOCK
+							/ in->sample_rate;
+	struct timespec deadline, poll = {0, 500000};
+
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+	while (!stopped(in)) {
+		size_t got = read_block(in, PCM_BLOCK * frame_size);
+
+		if (got < frame_size)
+			break;
+		convert(in, (int)(got / frame_size));
+
+		if (in->realtime) {
+			clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME,
+							&deadline, NULL);
+			deadline.tv_nsec += period;
+			deadline.tv_sec += deadline.tv_nsec / 1000000000;
+			deadline.tv_nsec %= 1000000000;
+		} else {
+			/* Do not overwrite frames the reader has not seen,
+			 * nor drop frames being recorded */
+			while (rtfi_busy() && !stopped(in))
+				nanosleep(&poll, NULL);
+		}
+
+		rtfi_process(in->block, PCM_BLOCK);
+
+		if (got < PCM_BLOCK * frame_size)
+			break;
+	}
+
+	rtfi_end_input();
+	return NULL;
+}
+
+static void *pcm_open(const struct rtfi_input_cfg *cfg, int *sample_rate,
+						int *bufsize, int *ecode)
+{
+	struct pcm_input *in;
+	int r = -E_OK;
+
+	if (cfg->format < 0 || cfg->format >= N_PCM_FORMATS
+	    || cfg->channels < 1 || cfg->sample_rate <= 0) {
+		r = -E_BADCFG;
+		goto disaster;
+	}
+
+	if (__CALLOC(in) == NULL) {
+		r = -E_NOMEM;
+		goto disaster;
+	}
+
+	in->format = cfg->format;
+	in->channels = cfg->channels;
+	in->realtime = cfg->realtime;
+	in->sample_rate = cfg->sample_rate;
+
+	if (NMALLOC(in->raw, (size_t)PCM_BLOCK * (size_t)cfg->channels
+				* (size_t)formats[cfg->format].size) == NULL) {
+		r = -E_NOMEM;
+		goto free_in;
+	}
+
+	if (strcmp(cfg->path, "-") == 0) {
+		in->fd = STDIN_FILENO;
+	} else if ((in->fd = open(cfg->path, O_RDONLY)) < 0) {
+		PERROR("cannot open %s\n", cfg->path);
+		r = -E_OTHER;
+		goto free_raw;
+	}
+
+	*sample_rate = cfg->sample_rate;
+	*bufsize = PCM_BLOCK;
+	*ecode = r;
+	return in;
+
+free_raw:
+	free(in->raw);
+free_in:
+	free(in);
+disaster:
+	*ecode = r;
+	return NULL;
+}
+
+static int pcm_start(void *input)
+{
+	struct pcm_input *in = input;
+
+	if (pthread_create(&in->thread, NULL, pcm_run, in) != 0)
+		return -E_OTHER;
+
+	in->started = 1;
+	return -E_OK;
+}
+
+static void pcm_close(void *input)
+{
+	struct pcm_input *in = input;
+
+	__atomic_store_n(&in->stop, 1, __ATOMIC_RELEASE);
+	if (in->started)
+		pthread_join(in->thread, NULL);
+
+	if (in->fd != STDIN_FILENO)
+		close(in->fd);
+	free(in->raw);
+	free(in);
+}
+
+const struct rtfi_backend pcm_backend = {
+	pcm_open, pcm_start, pcm_close
+};
@@ -0,0 +1,52 @@
+/*
+ * pcminput.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _PCMINPUT_H_
+#define _PCMINPUT_H_
+
+/* Input backend for raw PCM streams: interleaved samples, in the machine byte
+ * order, read from a file, FIFO or stdin (path "-"). Channels are mixed down
+ * to mono.
+ *
+ * If realtime is set, blocks are processed at the rate given by the sample
+ * rate. Otherwise they are processed as fast as possible, but never more than
+ * the reader of the frames can take. The end of the stream is signalled with
+ * rtfi_end_input(). */
+
+enum PCM_FORMAT {PCM_S16, PCM_S32, PCM_F32, N_PCM_FORMATS};
+
+/* Samples per block. With the default hop it completes at most one frame
+ * (see ARTFI_WAIT_BLOCK in rtfi.h). */
+#define PCM_BLOCK ARTFI_WAIT_BLOCK
+
+extern const struct rtfi_backend pcm_backend;
+
+/* Returns a PCM_FORMAT, or -1 if the name is not known */
+extern int pcm_format(const char *name);
+
+/* Bytes per sample */
+extern int pcm_sample_size(int format);
+
+/* Convert n interleaved frames of the given format to mono floats */
+extern void pcm_to_mono(const void *raw, int format, int channels,
+							float *dst, int n);
+
+#endif /* _PCMINPUT_H_ */
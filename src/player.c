@@ -0,0 +1,199 @@
+/*
+ * player.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <libjc/common.h>
+#include "rtfi.h"
+#include "player.h"
+
+/* How long to wait before checking again if the reader caught up */
+#define PL_POLL_NS 500000
+
+struct player {
+	struct ff_cursor cur;
+	/* frame value for each quantization level */
+	float *lut;
+	float frame[ARTFI_BSIZE];
+	uint64_t next_frame;
+	/* ns between frames, 0 for no pacing */
+	int64_t period;
+	struct timespec deadline;
+	int stop;
+	pthread_t thread;
+};
+
+static void add_ns(struct timespec *t, int64_t ns)
+{
+	ns += t->tv_nsec;
+	t->tv_sec += ns / 1000000000;
+	t->tv_nsec = ns % 1000000000;
+}
+
+static int stopped(struct player *p)
+{
+	return __atomic_load_n(&p->stop, __ATOMIC_ACQUIRE);
+}
+
+static void deliver(struct player *p)
+{ /* Wait for our turn and hand p->frame to the reader */
+	struct timespec poll = {0, PL_POLL_NS};
+
+	while (rtfi_busy() && !stopped(p))
+		nanosleep(&poll, NULL);
+
+	if (p->period) {
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &p->deadline,
+									NULL);
+		add_ns(&p->deadline, p->period);
+	}
+
+	rtfi_put_frame(p->frame);
+	p->next_frame++;
+}
+
+static void *player_run(void *arg)
+{
+	struct player *p = arg;
+	const int raw = !(p->cur.r->hdr->flags & FF_DELTA);
+	const int wide = p->cur.r->hdr->qbits > 8;
+	uint64_t frame;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &p->deadline);
+
+	while (!stopped(p)) {
+		if (raw) {
+			/* read directly from the mapped file */
+			const void *q = ff_cursor_next_raw(&p->cur, &frame);
+
+			if (q == NULL)
+				break;
+			if (wide) {
+				const uint16_t *q16 = q;
+
+				for (i = 0; i < ARTFI_BSIZE; i++)
+					p->frame[i] = p->lut[q16[i]];
+			} else {
+				const uint8_t *q8 = q;
+
+				for (i = 0; i < ARTFI_BSIZE; i++)
+					p->frame[i] = p->lut[q8[i]];
+			}
+		} else {
+			const unsigned int *q = ff_cursor_next_q(&p->cur, &frame);
+
+			if (q == NULL)
+				break;
+			for (i = 0; i < ARTFI_BSIZE; i++)
+				p->frame[i] = p->lut[q[i]];
+		}
+
+		if (frame > p->next_frame) {
+			float save[ARTFI_BSIZE];
+
+			memcpy(save, p->frame, sizeof(save));
+			for (i = 0; i < ARTFI_BSIZE; i++)
+				p->frame[i] = p->lut[0];
+			while (p->next_frame < frame && !stopped(p))
+				deliver(p);
+			memcpy(p->frame, save, sizeof(save));
+		}
+
+		deliver(p);
+	}
+
+	rtfi_end_input();
+	return NULL;
+}
+
+struct player *player_start(const struct ff_reader *r, uint64_t first_frame,
+						float speed, int *ecode)
+{
+	const struct ff_header *h = r->hdr;
+	struct player *p;
+	int i, n_levels = 1 << h->qbits;
+	int ret = -E_OK;
+
+	if (h->n_bands != ARTFI_BSIZE || speed < 0) {
+		PERROR("player: the file does not match this configuration\n");
+		ret = -E_BADCFG;
+		goto disaster;
+	}
+
+	if (__CALLOC(p) == NULL) {
+		ret = -E_NOMEM;
+		goto disaster;
+	}
+
+	if (NMALLOC(p->lut, (size_t)n_levels) == NULL) {
+		ret = -E_NOMEM;
+		goto free_p;
+	}
+
+	/* frames hold amplitudes, the file has dB */
+	for (i = 0; i < n_levels; i++)
+		p->lut[i] = powf(10, ff_level((unsigned int)i, h->db_lo,
+							h->db_step) / 20);
+
+	if ((ret = ff_cursor_init(&p->cur, r)) != -E_OK)
+		goto free_lut;
+
+	ff_cursor_seek(&p->cur, first_frame);
+	p->next_frame = first_frame;
+	p->period = (speed > 0)?
+		(int64_t)(1e9 * h->hop / h->sample_rate / speed) : 0;
+
+	if (pthread_create(&p->thread, NULL, player_run, p) != 0) {
+		ret = -E_OTHER;
+		goto free_cursor;
+	}
+
+	if (ecode != NULL)
+		*ecode = ret;
+	return p;
+
+free_cursor:
+	ff_cursor_free(&p->cur);
+free_lut:
+	free(p->lut);
+free_p:
+	free(p);
+disaster:
+	if (ecode != NULL)
+		*ecode = ret;
+	return NULL;
+}
+
+void player_stop(struct player *p)
+{
+	__atomic_store_n(&p->stop, 1, __ATOMIC_RELEASE);
+	pthread_join(p->thread, NULL);
+
+	ff_cursor_free(&p->cur);
+	free(p->lut);
+	free(p);
+}
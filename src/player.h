@@ -0,0 +1,46 @@
+/*
+ * player.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _PLAYER_H_
+#define _PLAYER_H_
+
+#include <stdint.h>
+#include "framereader.h"
+
+/* Replay a recorded file, feeding the frames through rtfi_put_frame() as if
+ * they came from the audio engine.
+ *
+ * Frames are delivered at speed times the rate they were recorded, or as fast
+ * as the reader takes them if speed is 0. In both cases the player waits if
+ * the reader is behind, so that no frames are overwritten. Frames lost while
+ * recording are replaced by silent frames. At the end of the file,
+ * rtfi_end_input() is called. */
+
+struct player;
+
+/* The file must have ARTFI_BSIZE bands and must stay open while playing.
+ * Returns NULL on error, with the error code in *ecode. */
+extern struct player *player_start(const struct ff_reader *r,
+				uint64_t first_frame, float speed, int *ecode);
+
+extern void player_stop(struct player *p);
+
+#endif /* _PLAYER_H_ */
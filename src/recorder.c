@@ -0,0 +1,178 @@
+/*
+ * recorder.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <libjc/common.h>
+#include "rtfi.h"
+#include "framewriter.h"
+#include "recorder.h"
+
+struct rec_slot {
+	unsigned long frame;
+	int64_t time_ns;
+	float data[ARTFI_BSIZE];
+};
+
+struct recorder {
+	struct ff_writer *w;
+
+	/* The queue is written only by the audio thread and read only by the
+	 * writer. head and tail are free running counters. */
+	struct rec_slot queue[REC_QUEUE_LEN];
+	unsigned int head, tail;
+	sem_t avail;
+	/* frames seen by the audio thread, and how many were dropped */
+	unsigned long frame_no, dropped;
+	int stop;
+
+	pthread_t writer;
+	int error;
+};
+
+static int64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return ts.tv_sec * (int64_t)1000000000 + ts.tv_nsec;
+}
+
+void recorder_push(void *rec_, const float *frame)
+{
+	struct recorder *rec = rec_;
+	unsigned int head = rec->head;
+	unsigned int tail = __atomic_load_n(&rec->tail, __ATOMIC_ACQUIRE);
+
+	if (head - tail < REC_QUEUE_LEN) {
+		struct rec_slot *slot = &rec->queue[head % REC_QUEUE_LEN];
+
+		slot->frame = rec->frame_no;
+		slot->time_ns = now_ns();
+		memcpy(slot->data, frame, sizeof(slot->data));
+		__atomic_store_n(&rec->head, head + 1, __ATOMIC_RELEASE);
+		sem_post(&rec->avail);
+	} else {
+		rec->dropped++;
+	}
+
+	rec->frame_no++;
+}
+
+int recorder_room(void *rec_)
+{
+	struct recorder *rec = rec_;
+	unsigned int tail = __atomic_load_n(&rec->tail, __ATOMIC_ACQUIRE);
+
+	return REC_QUEUE_LEN - (int)(rec->head - tail);
+}
+
+static void *writer_run(void *rec_)
+{
+	struct recorder *rec = rec_;
+
+	while (1) {
+		const struct rec_slot *slot;
+		unsigned int head;
+
+		sem_wait(&rec->avail);
+		head = __atomic_load_n(&rec->head, __ATOMIC_ACQUIRE);
+
+		if (rec->tail == head) {
+			/* woken up with nothing to do: it must be the stop */
+			if (__atomic_load_n(&rec->stop, __ATOMIC_ACQUIRE))
+				break;
+			continue;
+		}
+
+		slot = &rec->queue[rec->tail % REC_QUEUE_LEN];
+		if (ff_writer_put(rec->w, slot->frame, slot->time_ns,
+						slot->data) != -E_OK
+		    && !rec->error) {
+			PERROR("recorder: write error\n");
+			rec->error = 1;
+		}
+		__atomic_store_n(&rec->tail, rec->tail + 1, __ATOMIC_RELEASE);
+	}
+
+	return NULL;
+}
+
+struct recorder *recorder_open(const char *path, int qbits, int delta,
+				int sample_rate, int hop, int *ecode)
+{
+	struct recorder *rec;
+	int r = -E_OK;
+
+	if (__CALLOC(rec) == NULL) {
+		r = -E_NOMEM;
+		goto disaster;
+	}
+
+	rec->w = ff_writer_open(path, qbits, delta, sample_rate, hop,
+							now_ns(), &r);
+	if (rec->w == NULL)
+		goto free_rec;
+
+	if (sem_init(&rec->avail, 0, 0) != 0) {
+		r = -E_OTHER;
+		goto close_writer;
+	}
+
+	if (pthread_create(&rec->writer, NULL, writer_run, rec) != 0) {
+		r = -E_OTHER;
+		goto destroy_sem;
+	}
+
+	if (ecode != NULL)
+		*ecode = r;
+	return rec;
+
+destroy_sem:
+	sem_destroy(&rec->avail);
+close_writer:
+	ff_writer_close(rec->w);
+free_rec:
+	free(rec);
+disaster:
+	if (ecode != NULL)
+		*ecode = r;
+	return NULL;
+}
+
+void recorder_close(struct recorder *rec)
+{
+	__atomic_store_n(&rec->stop, 1, __ATOMIC_RELEASE);
+	sem_post(&rec->avail);
+	pthread_join(rec->writer, NULL);
+
+	if (ff_writer_close(rec->w) != -E_OK && !rec->error)
+		PERROR("recorder: write error\n");
+	if (rec->dropped)
+		PERROR("recorder: %lu frames dropped\n", rec->dropped);
+
+	sem_destroy(&rec->avail);
+	free(rec);
+}
@@ -0,0 +1,50 @@
+/*
+ * recorder.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _RECORDER_H_
+#define _RECORDER_H_
+
+/* Record ARTFI frames to a file (see framefile.h).
+ *
+ * The audio thread hands frames to recorder_push(), which only copies them
+ * into a lock-free queue. A separate thread converts them to dB, quantizes
+ * and writes them. If the writer falls behind by more than REC_QUEUE_LEN
+ * frames, frames are dropped (and a new chunk is started). */
+
+/* 2.56 seconds of frames */
+#define REC_QUEUE_LEN 256
+
+struct recorder;
+
+/* qbits must be 8 or 16. Returns NULL on error, with the error code in
+ * *ecode. */
+extern struct recorder *recorder_open(const char *path, int qbits, int delta,
+				int sample_rate, int hop, int *ecode);
+
+/* Queued frame sink (see rtfi_add_queued_sink) */
+extern void recorder_push(void *rec, const float *frame);
+extern int recorder_room(void *rec);
+
+/* Write the pending frames and close the file. The audio thread must not be
+ * pushing frames anymore. */
+extern void recorder_close(struct recorder *rec);
+
+#endif /* _RECORDER_H_ */
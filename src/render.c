@@ -0,0 +1,192 @@
+/*
+ * render.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <strings.h>
+#include <libjc/common.h>
+#include "render.h"
+#include "kernels.h"
+#include "../src_generated/spectral_tables.c"
+
+#ifndef M_PI
+#define M_PI (3.14159265358979323846)
+#endif /* M_PI */
+
+const char *const modenames[N_MODES] = {"ARTFI", "AES", "PES", "SPES", "NPES"};
+const char *const cmapnames[N_CMAPS] = {"iris", "gray"};
+
+const struct qrange qranges[N_MODES] = {
+	[ARTFI] = {-180, 0},
+	[AES] = {-180, 0},
+	[PES] = {0, LOWER_THRS},
+	[SPES] = {0, LOWER_THRS},
+	[NPES] = {-40, 0},
+};
+
+const struct contrast default_contrast[N_MODES] = {
+	[ARTFI] = {PEAK_VALUE, LOWER_THRS},
+	[AES] = {PEAK_VALUE, LOWER_THRS},
+	[PES] = {55, 50},
+	[SPES] = {40, 40},
+	[NPES] = {0, 8},
+};
+
+static int lookup(const char *const *names, int n, const char *name)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+		if (strcasecmp(names[i], name) == 0)
+			return i;
+
+	return -1;
+}
+
+int render_mode(const char *name)
+{
+	return lookup(modenames, N_MODES, name);
+}
+
+int render_cmap(const char *name)
+{
+	return lookup(cmapnames, N_CMAPS, name);
+}
+
+static inline float denorm0(float v,  float peak, float ths)
+{
+	float value = v - peak + ths;
+	return (value < ths)? ((value < 0) ? 0 : value) : ths;
+}
+
+static inline float denorm1(float v, float peak , float ths)
+{
+	return denorm0(v, peak, ths)/ths;
+}
+
+static inline struct RGB gray(float v)
+{
+	/* v between 0 and 1 */
+	unsigned char c = (unsigned char)(v*255);
+	return rgb(c, c, c);
+}
+
+static inline struct RGB iris(float v)
+{
+	/* v between 0 and 1 */
+	/* float v = v; (pasthrough) */
+	/*float c = v * (1 - v) * (0.5 - v) * (0.5 - v) * 64;*/
+	/*float c = 4*v*(1-v)*((0.5 - v)*(0.5 - v) *11.6569 + 0.5);*/
+	float c = (float)(6.75*v*v*v - 13.5 * v*v + 6.75 * v);
+	float h = (float)(((v > 0.5)? (v - 1) : v) * 2 * M_PI);
+	return hcv2rgb(hcv(h, c, v*v));
+}
+
+static struct RGB (*const colormaps[N_CMAPS])(float) = {
+	[CMAP_IRIS] = iris,
+	[CMAP_GRAY] = gray,
+};
+
+static inline intensity_t quantize(float v, const struct qrange *q)
+{
+	float l = (v - q->lo) * ((INTENSITY_LEVELS - 1) / (q->hi - q->lo));
+
+	return (l > 0)? ((l < INTENSITY_LEVELS - 1)? (intensity_t)(l + 0.5f)
+						: INTENSITY_LEVELS - 1)
+			: 0;
+}
+
+void render_palette(struct RGB pal[INTENSITY_LEVELS], int mode,
+				const struct contrast *ct, unsigned int cmap)
+{
+	const struct qrange *q = &qranges[mode];
+	float step = (q->hi - q->lo) / (INTENSITY_LEVELS - 1);
+	int i;
+
+	for (i = 0; i < INTENSITY_LEVELS; i++)
+		pal[i] = colormaps[cmap](denorm1(q->lo + (float)i*step,
+							ct->peak, ct->range));
+}
+
+void pipeline_reset(struct pipeline *p)
+{
+	memset(p->pesbuffer, 0, sizeof(p->pesbuffer));
+	p->bufindex = 0;
+}
+
+void pipeline_step(struct pipeline *p, const float *db, int mode)
+{
+	float current[REAL_N_BANDS], level[REAL_N_BANDS];
+	float spesbuf[REAL_N_BANDS], spesmax;
+	int i;
+
+	/* the weights of the contour of each band's level */
+	if (mode > ARTFI)
+		kern->iso(level, db, REAL_N_BANDS, iso_weight[0], ISO_ROWS,
+				ISO_COLS, ISO_SPL_OFFSET - ISO_LEVEL0);
+	else
+		memcpy(level, db, sizeof(level));
+
+	for (i = 0; i < REAL_N_BANDS; i++)
+		current[i] = denorm0(level[i], PEAK_VALUE, LOWER_THRS);
+
+	kern->pes(p->pesbuffer[p->bufindex], current, REAL_N_BANDS, hindex,
+							ARSIZE(hindex));
+	spesmax = kern->spes(spesbuf, p->pesbuffer[0], REAL_N_BANDS,
+							REAL_N_BANDS);
+
+	for (i = 0; i < REAL_N_BANDS; i++) {
+		switch (mode) {
+		default:
+		case NPES:
+			p->val[i] = spesbuf[i] - spesmax;
+			break;
+		case SPES:
+			p->val[i] = spesbuf[i];
+			break;
+		case PES:
+			p->val[i] = p->pesbuffer[p->bufindex][i];
+			break;
+		case AES:
+		case ARTFI:
+			p->val[i] = level[i];
+			break;
+		}
+	}
+
+	p->bufindex = (p->bufindex + 1) % TIME_AVG;
+}
+
+void render_column(struct pipeline *p, const float *db, int mode,
+			const struct resampler *rs, intensity_t *col, int stride)
+{
+	const struct qrange *q = &qranges[mode];
+	float rows[rs->rows];
+	int y;
+
+	pipeline_step(p, db, mode);
+	resample(rs, p->val, rows);
+
+	for (y = 0; y < rs->rows; y++) {
+		col[y*stride] = (y >= rs->y0 && y < rs->y1)?
+						quantize(rows[y], q) : 0;
+	}
+}
@@ -0,0 +1,102 @@
+/*
+ * render.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _RENDER_H_
+#define _RENDER_H_
+
+#include <stdint.h>
+#include <jgl/color.h>
+#include "../src_generated/rtfi_defines.h"
+#include "resample.h"
+
+/* Turning ARTFI frames into images, without depending on how (or if) they are
+ * displayed. Shared by the visualizer and the image export.
+ *
+ * Each frame (in dB) goes through the pipeline of one of the modes and the
+ * result is quantized to an intensity level. Intensities are converted to
+ * colors through a palette, built from a colormap and the contrast of the
+ * mode, so that changing them does not require processing the frames again.
+ * Set INTENSITY_BITS to 16 for finer quantization. */
+
+#define INTENSITY_BITS 8
+#define INTENSITY_LEVELS (1 << INTENSITY_BITS)
+
+#if INTENSITY_BITS <= 8
+typedef uint8_t intensity_t;
+#else
+typedef uint16_t intensity_t;
+#endif
+
+#define TIME_AVG 5
+#define FREQ_AVG 5
+#define LOWER_THRS (90)
+#define PEAK_VALUE (-50) /* ?????????????? */
+/* dB SPL of a level of 0 dB, for the equal loudness contours of AES and the
+ * modes after it: the peak is 90 dB SPL (the loudest contour) */
+#define ISO_SPL_OFFSET (LOWER_THRS - PEAK_VALUE)
+
+enum MODES {ARTFI, AES, PES, SPES, NPES, N_MODES};
+extern const char *const modenames[N_MODES];
+
+enum COLORMAPS {CMAP_IRIS, CMAP_GRAY, N_CMAPS};
+extern const char *const cmapnames[N_CMAPS];
+
+/* Values between peak - range and peak are mapped to the colormap. */
+struct contrast {
+	float peak, range;
+};
+
+/* Span of the values stored in the intensity buffer for each mode. It should
+ * be wider than any sensible contrast setting. */
+struct qrange {
+	float lo, hi;
+};
+
+extern const struct qrange qranges[N_MODES];
+extern const struct contrast default_contrast[N_MODES];
+
+struct pipeline {
+	float pesbuffer[TIME_AVG][REAL_N_BANDS];
+	unsigned int bufindex;
+	/* output of the last step, for the mode it was run in */
+	float val[REAL_N_BANDS];
+};
+
+/* Mode or colormap number from its name (case insensitive), or -1 */
+extern int render_mode(const char *name);
+extern int render_cmap(const char *name);
+
+extern void pipeline_reset(struct pipeline *p);
+
+/* Process one ARTFI frame (in dB) and leave in p->val the values for all the
+ * bands, in the units of qranges[mode]. */
+extern void pipeline_step(struct pipeline *p, const float *db, int mode);
+
+/* Process one ARTFI frame (in dB) and write the levels for the rows of rs
+ * into col, one every stride elements. Rows outside the band range get 0. */
+extern void render_column(struct pipeline *p, const float *db, int mode,
+			const struct resampler *rs, intensity_t *col, int stride);
+
+/* Color of each intensity level of a mode */
+extern void render_palette(struct RGB pal[INTENSITY_LEVELS], int mode,
+				const struct contrast *ct, unsigned int cmap);
+
+#endif /* _RENDER_H_ */
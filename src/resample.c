@@ -0,0 +1,154 @@
+/*
+ * resample.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <libjc/common.h>
+#include "resample.h"
+#include "kernels.h"
+
+static inline int imax(int a, int b)
+{
+	return (a > b)? a : b;
+}
+
+static inline int imin(int a, int b)
+{
+	return (a < b)? a : b;
+}
+
+static int pool_taps(struct resampler *rs, int y, int nbands, double b0,
+								double b1)
+{ /* Fill the taps of a row that covers one or more bands. Returns the number
+	of taps used. */
+	int b, t = 0, lo = imax((int)floor(b0), 0);
+	int hi = imin((int)ceil(b1), nbands);
+	double total = 0;
+
+	for (b = lo; b < hi; b++, t++) {
+		double overlap = fmin(b + 1, b1) - fmax(b, b0);
+
+		rs->band[t*rs->rows + y] = b;
+		rs->weight[t*rs->rows + y] = (float)overlap;
+		total += overlap;
+	}
+
+	/* bands that fall outside the range are not counted */
+	for (b = 0; b < t; b++)
+		rs->weight[b*rs->rows + y] = (float)(rs->weight[b*rs->rows + y]
+								/ total);
+
+	return t;
+}
+
+static int interp_taps(struct resampler *rs, int y, int nbands, double c)
+{ /* Fill the taps of a row whose center falls at band c (fractional) */
+	int i0 = (int)floor(c);
+	float frac = (float)(c - i0);
+
+	if (c < -0.5 || c > nbands - 0.5)
+		return 0;
+
+	rs->band[y] = imin(imax(i0, 0), nbands - 1);
+	rs->weight[y] = 1 - frac;
+	rs->band[rs->rows + y] = imin(imax(i0 + 1, 0), nbands - 1);
+	rs->weight[rs->rows + y] = frac;
+
+	return 2;
+}
+
+int resampler_init(struct resampler *rs, int rows, int nbands,
+					double base, double span, int pool)
+{
+	double scale = span / rows;
+	int y, t;
+
+	rs->rows = rows;
+	/* pooling only makes sense if a row covers more than one band */
+	rs->pool = (scale > 1)? pool : RS_MEAN;
+	rs->ntaps = (scale > 1)? (int)ceil(scale) + 1 : 2;
+	rs->y0 = rows;
+	rs->y1 = 0;
+
+	/* resampler_free frees both, even if the first allocation failed */
+	rs->band = NULL;
+	rs->weight = NULL;
+	if (NMALLOC(rs->band, (size_t)rs->ntaps * (size_t)rows) == NULL
+	    || NMALLOC(rs->weight, (size_t)rs->ntaps * (size_t)rows) == NULL) {
+		resampler_free(rs);
+		return -E_NOMEM;
+	}
+
+	for (y = 0; y < rows; y++) {
+		int used;
+
+		if (scale > 1)
+			used = pool_taps(rs, y, nbands, base + y*scale,
+						base + (y + 1)*scale);
+		else
+			used = interp_taps(rs, y, nbands,
+						base + (y + 0.5)*scale - 0.5);
+
+		if (used) {
+			rs->y0 = imin(rs->y0, y);
+			rs->y1 = y + 1;
+		} else {
+			rs->band[y] = 0;
+		}
+
+		for (t = used; t < rs->ntaps; t++) {
+			rs->band[t*rows + y] = rs->band[y];
+			rs->weight[t*rows + y] = 0;
+		}
+	}
+
+	if (rs->y1 < rs->y0)
+		rs->y1 = rs->y0;
+
+	return -E_OK;
+}
+
+void resampler_free(struct resampler *rs)
+{
+	free(rs->band);
+	free(rs->weight);
+	rs->band = NULL;
+	rs->weight = NULL;
+}
+
+void resample(const struct resampler *rs, const float *src, float *dst)
+{ /* Each tap is a gather, done by the kernels */
+	const int rows = rs->rows, y0 = rs->y0, n = rs->y1 - rs->y0;
+	int t, y;
+
+	for (y = y0; y < y0 + n; y++)
+		dst[y] = (rs->pool == RS_MAX)? -INFINITY : 0;
+
+	for (t = 0; t < rs->ntaps; t++) {
+		const int *band = rs->band + t*rows + y0;
+
+		if (rs->pool == RS_MAX)
+			kern->resample_max(dst + y0, src, band, n);
+		else
+			kern->resample_mean(dst + y0, src, band,
+						rs->weight + t*rows + y0, n);
+	}
+}
@@ -0,0 +1,58 @@
+/*
+ * resample.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _RESAMPLE_H_
+#define _RESAMPLE_H_
+
+/* Map a range of bands onto a number of rows (i.e. screen pixels).
+ *
+ * Row y covers bands [base + y*span/rows, base + (y+1)*span/rows). When there
+ * are more bands than rows, the bands covered by a row are pooled (with a
+ * weighted mean or the maximum); when there are less, rows are linearly
+ * interpolated.
+ *
+ * The table is stored padded to a fixed number of taps per row, tap-major
+ * (band[t*rows + y]), so that applying it is a straight loop over rows for
+ * each tap (kern->resample_mean or resample_max). Unused taps repeat the first
+ * band of the row with weight 0. */
+
+enum RS_POOL {RS_MEAN, RS_MAX, RS_N_POOL};
+
+struct resampler {
+	int rows;
+	int ntaps;
+	/* rows outside [y0, y1) are out of the band range */
+	int y0, y1;
+	int pool;
+	int *band;
+	float *weight;
+};
+
+/* Returns -E_OK or -E_NOMEM */
+extern int resampler_init(struct resampler *rs, int rows, int nbands,
+					double base, double span, int pool);
+extern void resampler_free(struct resampler *rs);
+
+/* Compute rows y0 to y1 - 1 of dst from the bands in src. The rest of dst is
+ * not touched. */
+extern void resample(const struct resampler *rs, const float *src, float *dst);
+
+#endif /* _RESAMPLE_H_ */
@@ -27,43 +27,21 @@
 #include <semaphore.h>
 #include <jack/jack.h>
 #include <libjc/common.h>
-#include "../src_generated/rtfi_params.c"
 #include "rtfi.h"
-
-#define DIVUP(a, b) ((((a) - 1) / (b)) + 1)
+#include "pcminput.h"
 
 #define CLIENTNAME "RTFI"
 
 typedef jack_default_audio_sample_t sample_t;
 
-/* These are circular buffers used to store the last samples, in order to
- * compute the decimating FIR across each block */
-#define CB_LEN DFILTER_N
-static sample_t last_samples[RTFI_STEPS][CB_LEN] = {{0}};
-/* the cb_states are 1 + index of latest sample. That means the are initialized
- * to CB_LEN, or 0, as they wrap around CB_LEN */
-static int cb_states[RTFI_STEPS];
-
-/* Working area */
-static sample_t *decbuf = NULL;
-static complex float yprev[RTFI_STEPS][BLOCK];
-static complex float partial_power[RTFI_STEPS][BLOCK];
-static int block_avg_nsamples[RTFI_STEPS];
-static const struct rtfi_param *rtfi_cfg;
-
-/* we use this counter in case  we have to calculate each 2^n frames, instead
- * of every frame. This happens if jack's buffer size is less than 2^STEPS, the
- * lasts steps don't produce outputs in every call to the process callback
- * We don't care if frame count overflows */
-static int frame_count;
-/* Remainig samples to be processed before completing the ARTFI block*/
-static int partial_rem;
-/* Each ARTFI block is made by processing block_input_len samples and averaging
- * the outputs */
-static int block_input_len;
-
-static jack_nframes_t sr;
+/* The engine fed by the input backend */
+static struct rtfi_engine *live;
+static int sr;
+
+/* Input */
+static const struct rtfi_backend *backend;
 static jack_port_t* inp;
+static int input_ended;
 
 /* Communication */
 float rtfi_blocks[ARTFI_DELAY][ARTFI_BSIZE];
@@ -71,293 +49,202 @@ sem_t *block_lock;
 static int b_write;
 /* int b_read; */ /* Let the reader take care of the read index */
 
-static inline int min(int a, int b)
-{
-	return (a < b)? a : b;
-}
+static struct {
+	rtfi_sink_t fn;
+	rtfi_room_t room;
+	void *arg;
+} sinks[RTFI_MAX_SINKS];
+static int n_sinks;
+/* Most frames a call to rtfi_process() can produce */
+static int block_frames = 1;
 
-static inline sample_t cbuf_address(sample_t *cb, int cb_state, int delay)
-{ /* DELAY MUST BE >= 1 !!!!!!!!!!!!!!!!!!*/
-	return cb[(cb_state - delay) & (CB_LEN - 1)]; /*"%" retains sign, so it
-							is not useful */
-}
+static float *publish_frame(void *arg, float *frame)
+{ /* Hand the frame in rtfi_blocks[b_write] to the sinks and the reader, and
+	return the buffer for the next one */
+	int i;
 
-static inline int cbuf_copy(sample_t *cb, int cb_state, sample_t *src, int n_samples)
-{ /* Copy n_samples into the circular buffer (n_samples <= CB_LEN !!!!!)
-	The only possibilities are n_samples = DFILTER_N,
-	or nsamples = DFILTER_N/(2^n). In the latter, cb_state can only be
-	k*2^n
-   returns the new value of cb_state
-  */
-  memcpy(cb + cb_state % CB_LEN, src, n_samples*sizeof(*cb));
-  return (cb_state + n_samples) % CB_LEN;
-}
+	(void)arg;
+	(void)frame;
 
-static inline sample_t choose_src(sample_t *cb, int cb_state, sample_t *src, int i)
-{ /* Get a sample either from the current block (src), or the saved block,
-	dependig on the index */
-	return (i < 0)? cbuf_address(cb, cb_state, -i) : src[i];
-}
+	for (i = 0; i < n_sinks; i++)
+		sinks[i].fn(sinks[i].arg, rtfi_blocks[b_write]);
 
-static inline int decimate(const float *h, sample_t *cb, int cb_state, sample_t *src,
-						int n_samples, sample_t *dst)
-{ /* We are going to assume that the decimating filter is simmetric and has an
-	even number of coefficients. In fact, if DFILTER_N is not a power of 2,
-	expect everything to fall apart
-	n_samples is the number of INPUT samples to process
-	the number of samples produced is (n_samples+1)/2
-	At the end of the process, the last samples of SOURCE are saved*/
-	const int first_stage_l = min(DFILTER_N - 1, n_samples);
-	const int to_copy = min(DFILTER_N, n_samples);
-	int n;
-/*
-	for (n = 0; n < first_stage_l; n += 2) {
-		int i;
-		sample_t acc = 0;
+	INCMOD(b_write, ARTFI_DELAY);
+	sem_post(block_lock);
 
-		for (i = 0; i < (DFILTER_N / 2); i++) {
-			acc += h[i] * (choose_src(cb, cb_state, src, n-i)
-			   + choose_src(cb, cb_state, src, (n+i) - (DFILTER_N - 1)));
-		}
+	return rtfi_blocks[b_write];
+}
 
-		dst[n/2] = acc;
-	}
+int rtfi_process(sample_t *inb, int nframes)
+{
+	return rtfi_engine_run(live, inb, nframes);
+}
 
-	for ( ; n < n_samples; n += 2) {
-		int i;
-		sample_t acc = 0;
+static int jack_process(jack_nframes_t nframes, void *arg)
+{
+	(void)arg;
+	return rtfi_process(jack_port_get_buffer(inp, nframes), (int)nframes);
+}
 
-		for (i = 0; i < (DFILTER_N / 2); i++) {
-			acc += h[i] * (src[n-i] + src[(n+i) - (DFILTER_N - 1)]);
-		}
+static void *jack_open(const struct rtfi_input_cfg *cfg, int *sample_rate,
+						int *bufsize, int *ecode)
+{ /* Returns a jack client on success, NULL on failure */
+	jack_client_t* client;
 
-		dst[n/2] = acc;
+	(void)cfg;
+	client = jack_client_open(CLIENTNAME, JackNullOption, NULL);
+	if (client == NULL) {
+		PERROR("Could not register client\n");
+		*ecode = -E_OTHER;
+		return NULL;
 	}
-*/
 
-	for (n = 0; n < n_samples; n += 2) {
-		int i;
-		sample_t acc = 0;
+	inp = jack_port_register(client, "Input",
+			JACK_DEFAULT_AUDIO_TYPE, JackPortIsInput, 0);
 
-		for (i = 0; i < (DFILTER_N / 2); i++) {
-			acc += h[i] * (choose_src(cb, cb_state, src, n-i)
-			   + choose_src(cb, cb_state, src, (n+i) - (DFILTER_N - 1)));
-		}
+	jack_set_process_callback(client, jack_process, NULL);
 
-		dst[n/2] = acc;
-	}
+	*bufsize = (int)jack_get_buffer_size(client);
+	*sample_rate = (int)jack_get_sample_rate(client);
+	*ecode = -E_OK;
 
-	return cbuf_copy(cb, cb_state, src + n_samples - to_copy, to_copy);
+	return client;
+}
+
+static int jack_start(void *client)
+{
+	return jack_activate(client);
 }
 
-static inline int KTH_BUFSIZE(int bs, int k)
-{ /* Minimum buffer size is 1.*/
-	int kbs = bs >> (k+1);
-	return kbs? kbs : 1;
+static void jack_close(void *client)
+{
+	jack_client_close(client);
 }
 
-static inline int decbuf_index(int jack_bufsize, int k)
-{ /* Return the offset of the first element of the section of "decbuf"
-	corresponding to step k ( 0 <= k < RTFI_STEPS )*/
-	int i, acc = 0;
+static const struct rtfi_backend jack_backend = {
+	jack_open, jack_start, jack_close
+};
+
+void *rtfi_prepare(int *ecode, sem_t *sem, const struct rtfi_input_cfg *cfg)
+{ /* Returns an input handle on success, NULL on failure, error code in
+	*ecode */
+	void *input;
+	int bs, rate;
+	int r = 0;
 
-	for (i = 0; i < k; i++) {
-		acc += KTH_BUFSIZE(jack_bufsize, i);
+	backend = (cfg != NULL && cfg->backend == RTFI_IN_PCM)?
+					&pcm_backend : &jack_backend;
+	input_ended = 0;
+
+	input = backend->open(cfg, &rate, &bs, &r);
+	if (input == NULL)
+		goto disaster;
+	sr = rate;
+
+	rtfi_set_output(sem);
+
+	/* not on stdout, which may be carrying frames */
+	PERROR("%d X %d\n", bs, RTFI_STEPS);
+
+	/* Leave activation to the caller */
+	live = rtfi_engine_new(sr, bs, rtfi_blocks[b_write], publish_frame,
+								NULL, &r);
+	if (live == NULL) {
+		rtfi_unload(input);
+		input = NULL;
+	} else {
+		block_frames = bs / rtfi_engine_hop(live) + 1;
 	}
 
-	return acc;
+disaster:
+	if (ecode != NULL)
+		*ecode = r;
+
+	return input;
 }
 
-static inline float abs2(float complex z)
+void rtfi_unload(void *input)
 {
-	return crealf(z)*crealf(z) + cimagf(z)*cimagf(z);
+	backend->close(input);
+	rtfi_engine_free(live);
+	live = NULL;
 }
 
-static inline int STEP_RUNNABLE(int bs, int step, int frame_count)
+int rtfi_launch(void *input)
 {
-	int skip_n = (step - __builtin_clz(bs) + 1); /* 0 means do always, 1
-			 do each 2 blocks, 2 do each 4 blocks, etc */
-	return !(frame_count % (1 << ((skip_n <= 0) ? 0 : skip_n)));
+	return backend->start(input);
 }
 
-static int rtfi_process(jack_nframes_t nframes, void *arg)
+int rtfi_add_queued_sink(rtfi_sink_t sink, rtfi_room_t room, void *arg)
 {
-	sample_t *inb;
-	int step, pstep, processed = 0;
-	const complex float *a1 = rtfi_cfg->a1;
-	const float *k = rtfi_cfg->k;
-
-	inb = jack_port_get_buffer(inp, nframes);
-
-	for (step = 0; step < RTFI_STEPS; step++) {
-		int n_samples_in = KTH_BUFSIZE(nframes, step-1);
-	/*	int n_samples_out = KTH_BUFSIZE(nframes, step); */
-		sample_t *src, *dst;
-
-		src = (step)? (decbuf + decbuf_index(nframes,step-1)): inb;
-		dst = (decbuf + decbuf_index(nframes,step));
-
-		if (!STEP_RUNNABLE(nframes, step, frame_count)) {
-			cb_states[step] = cbuf_copy(last_samples[step],
-						     cb_states[step], src, 1);
-			break;
-		} else {
-			cb_states[step] = decimate(rtfi_cfg->decfilter,
-				last_samples[step], cb_states[step], src,
-							n_samples_in, dst);
-		}
-	}
+	if (n_sinks >= RTFI_MAX_SINKS)
+		return -E_OTHER;
 
-#define ARTFI_LOC(step, blockn) (step * BLOCK + (BLOCK - 1 - blockn))
-
-	while (processed < nframes) {
-		int to_process = min(nframes - processed, partial_rem);
-
-		for (pstep = 0; pstep < RTFI_STEPS
-				&& STEP_RUNNABLE(nframes, pstep, frame_count);
-								pstep++) {
-			int bk, iinit, iend;
-			sample_t *src = (decbuf + decbuf_index(nframes,pstep));
-
-			iinit = DIVUP(processed, 2 << pstep);
-			iend = DIVUP(processed + to_process, 2 << pstep);
-
-			if (partial_rem == block_input_len)
-				block_avg_nsamples[pstep] = (iend - iinit);
-			else
-				block_avg_nsamples[pstep] += (iend - iinit);
-
-			for (bk = 0; bk < BLOCK && ARTFI_LOC(pstep, bk) < N_BANDS; bk++) {
-				int i;
-				complex float y = yprev[pstep][bk];
-				float yacc = 0;
-
-				for (i = iinit; i < iend; i++) {
-					y = k[bk] * src[i] + a1[bk] * y;
-				/*	y = src[i]; */
-					yacc += abs2(y);
-				}
-
-				yprev[pstep][bk] = y;
-				/* Could we have that for some artfi block, some
-				 * pstep produces no samples to average?
-				 * Not with current settings. We don't care */
-			/*	rtfi_blocks[b_write][ARTFI_LOC(pstep, bk)] =
-					((iend-iinit)?
-						yacc / (iend - iinit)
-						: 0
-					)
-				     +  ((partial_rem == block_input_len)?
-							0
-						:rtfi_blocks[b_write][ARTFI_LOC(pstep, bk)]
-					); */
-				rtfi_blocks[b_write][ARTFI_LOC(pstep, bk)] =
-					(yacc +
-					((partial_rem == block_input_len)?
-							0
-						:rtfi_blocks[b_write][ARTFI_LOC(pstep, bk)]
-					))
-					/ ((partial_rem == to_process)?
-						block_avg_nsamples[pstep]
-						:1);
-			}
-		}
-
-		partial_rem -= to_process;
-		processed += to_process;
-		if (partial_rem == 0) {
-			INCMOD(b_write, ARTFI_DELAY);
-			partial_rem = block_input_len;
-			sem_post(block_lock);
-		}
-	}
+	sinks[n_sinks].fn = sink;
+	sinks[n_sinks].room = room;
+	sinks[n_sinks].arg = arg;
+	n_sinks++;
 
-	frame_count++;
-	return 0;
+	return -E_OK;
 }
 
-static inline int decbuf_minsize(int jack_bufsize) {
-	return decbuf_index(jack_bufsize, RTFI_STEPS);
+int rtfi_add_sink(rtfi_sink_t sink, void *arg)
+{
+	return rtfi_add_queued_sink(sink, NULL, arg);
 }
 
-void *rtfi_prepare(int *ecode, sem_t *sem)
-{ /* Returns a jack client on success, NULL on failure, error code in *ecode */
-	jack_client_t* client;
-	int bs, dbs, i;
-	int r = 0;
-
-	/* Jack initialization */
-	client = jack_client_open(CLIENTNAME, JackNullOption, NULL);
-	if (client == NULL) {
-		PERROR("Could not register client\n");
-		r = -E_OTHER;
-		goto disaster;
-	}
+int rtfi_samplerate(void)
+{
+	return sr;
+}
 
-	inp = jack_port_register(client, "Input",
-			JACK_DEFAULT_AUDIO_TYPE, JackPortIsInput, 0);
+int rtfi_hop(void)
+{
+	return rtfi_engine_hop(live);
+}
 
-	jack_set_process_callback(client, rtfi_process, NULL);
-
-	bs = jack_get_buffer_size(client);
-	dbs = decbuf_minsize(bs);
-	printf("%d X %d => %d\n", bs, RTFI_STEPS, dbs);
-	sr = jack_get_sample_rate(client);
-
-	switch (sr) {
-		case 44100:
-			rtfi_cfg = &rtfi_44100;
-			break;
-		case 48000:
-			rtfi_cfg = &rtfi_48000;
-			break;
-		case 96000:
-			rtfi_cfg = &rtfi_96000;
-			break;
-		default:
-			goto disaster;
-	}
+void rtfi_set_output(sem_t *sem)
+{
+	block_lock = sem;
+}
 
-	block_input_len = ceilf((sr * BLK_SIZE_MS) / 1000.0);
-	partial_rem = block_input_len;
+int rtfi_pending(void)
+{
+	int sv;
 
-	if (NMALLOC(decbuf, dbs) == NULL)
-		r = -E_NOMEM;
+	sem_getvalue(block_lock, &sv);
+	return sv;
+}
 
-	block_lock = sem;
+int rtfi_busy(void)
+{
+	int i;
 
-	for (i = 0; i < ARSIZE(yprev); i++)
-		yprev[0][i] = 0;
+	/* the pending frames, the one being read and the one being filled
+	 * must fit in the ring */
+	if (rtfi_pending() + block_frames > ARTFI_DELAY - 2)
+		return 1;
 
-	for (i = 0; i < ARSIZE(partial_power); i++)
-		partial_power[0][i] = 0;
+	for (i = 0; i < n_sinks; i++)
+		if (sinks[i].room != NULL
+		    && sinks[i].room(sinks[i].arg) < block_frames)
+			return 1;
 
-/* Leave activation to the caller */
-/*	if (jack_activate(client)) {
-		printf("Could not activate client\n");
-		r = 3;
-		goto disaster;
-	}
-*/
-disaster:
-	if (r != 0) {
-		rtfi_unload(client);
-		client = NULL;
-	}
-	if (ecode != NULL)
-		*ecode = r;
+	return 0;
+}
 
-	return client;
+void rtfi_put_frame(const float *frame)
+{
+	memcpy(rtfi_blocks[b_write], frame, sizeof(rtfi_blocks[b_write]));
+	publish_frame(NULL, rtfi_blocks[b_write]);
 }
 
-void rtfi_unload(void *client)
+void rtfi_end_input(void)
 {
-	jack_client_close(client);
-	free(decbuf);
-	decbuf = NULL;
+	__atomic_store_n(&input_ended, 1, __ATOMIC_RELEASE);
 }
 
-int rtfi_launch(void *client)
+int rtfi_input_ended(void)
 {
-	return jack_activate(client);
+	return __atomic_load_n(&input_ended, __ATOMIC_ACQUIRE);
 }
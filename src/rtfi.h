@@ -23,22 +23,97 @@
 #define _RTFI_H_
 
 #include "../src_generated/rtfi_defines.h"
+#include "engine.h"
 
-#define BLK_SIZE_MS 10
+/* Inputs that wait for the reader (see rtfi_busy) give the engine blocks of
+ * at most this many samples */
+#define ARTFI_WAIT_BLOCK 256
 
-/* Maximum lag (in blocks) between the graphical thread and the audio thread,
- * plus one,
- * Of course the minimum value is 1 + 1 = 2 */
-#define ARTFI_DELAY 6
+/* Frames in the ring between the audio thread and the reader: the frames of
+ * one of those blocks at the shortest hop, the one being read and the one
+ * being filled */
+#define ARTFI_DELAY (ARTFI_WAIT_BLOCK / RTFI_MIN_HOP + 3)
 #define ARTFI_BSIZE N_BANDS
 
 /* Macros to advance or recede an index in a circular array. Use with caution */
 #define INCMOD(v, m) v = (v + 1) % (m)
 #define DECMOD(v, m) v = (v - 1) % (m)
 
-extern void *rtfi_prepare(int *ecode, sem_t *sem);
-extern int rtfi_launch(void *client);
-extern void rtfi_unload(void *client);
+/* Maximum number of frame sinks */
+#define RTFI_MAX_SINKS 4
+
+/* A frame sink is called from the audio thread each time a frame is completed,
+ * with the ARTFI_BSIZE values of the frame. It must be real-time safe. */
+typedef void (*rtfi_sink_t)(void *arg, const float *frame);
+
+/* Number of frames a queued sink can still take without dropping any */
+typedef int (*rtfi_room_t)(void *arg);
+
+/* Input backends */
+enum RTFI_INPUT {RTFI_IN_JACK, RTFI_IN_PCM};
+
+struct rtfi_input_cfg {
+	int backend;
+	/* Only for RTFI_IN_PCM (see pcminput.h) */
+	const char *path;
+	int format;
+	int channels;
+	int sample_rate;
+	int realtime;
+};
+
+/* A backend delivers the input to rtfi_process(), always in blocks of the
+ * same size, which must be a power of two. open() returns a handle, or NULL
+ * with the error in *ecode. start() begins the delivery and close() stops it
+ * and frees the handle. */
+struct rtfi_backend {
+	void *(*open)(const struct rtfi_input_cfg *cfg, int *sample_rate,
+						int *bufsize, int *ecode);
+	int (*start)(void *input);
+	void (*close)(void *input);
+};
+
+/* If cfg is NULL, JACK is used. Returns an input handle on success, NULL on
+ * failure, error code in *ecode */
+extern void *rtfi_prepare(int *ecode, sem_t *sem,
+					const struct rtfi_input_cfg *cfg);
+extern int rtfi_launch(void *input);
+extern void rtfi_unload(void *input);
+
+/* Process a block of input samples with the live engine (see engine.h).
+ * Called by the backends. */
+extern int rtfi_process(float *inb, int nframes);
+
+/* Called by backends (or the player) after the last frame, if the input has
+ * an end. */
+extern void rtfi_end_input(void);
+extern int rtfi_input_ended(void);
+
+/* Sinks must be added before rtfi_launch(). Returns -E_OK, or -E_OTHER if
+ * there are too many. */
+extern int rtfi_add_sink(rtfi_sink_t sink, void *arg);
+/* Same, for a sink that queues frames for another thread: inputs that can
+ * wait (see rtfi_busy()) do not let it overflow. */
+extern int rtfi_add_queued_sink(rtfi_sink_t sink, rtfi_room_t room,
+								void *arg);
+
+/* Only valid after rtfi_prepare() */
+extern int rtfi_samplerate(void);
+/* input samples per frame */
+extern int rtfi_hop(void);
+
+/* Frames can also come from somewhere other than the audio engine (e.g. a
+ * recording being replayed). In that case, rtfi_prepare() is not called and
+ * the semaphore is set with rtfi_set_output(), then frames are delivered with
+ * rtfi_put_frame(), from a single thread. rtfi_pending() is the number of
+ * frames not yet taken by the reader. */
+extern void rtfi_set_output(sem_t *sem);
+extern void rtfi_put_frame(const float *frame);
+extern int rtfi_pending(void);
+/* Non-zero if the frames of the next input block could overwrite frames the
+ * reader has not taken, or overflow a queued sink. Inputs that are not real
+ * time wait while it is set. */
+extern int rtfi_busy(void);
 
 /* rtfi_blocks[?][0] : highest frequency
  * rtfi_blocks[?][ARTFI_BSIZE-1] : lowest frequency */
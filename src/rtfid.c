@@ -0,0 +1,840 @@
+/*
+ * rtfid.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+/* Headless analyzer: the same engine and frame sinks as the visualizer, but
+ * without SDL. Frames can additionally be written to stdout, and the program
+ * is controlled with signals or through a UNIX socket. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <time.h>
+#include <signal.h>
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <semaphore.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <libjc/cmdopt/optparse.h>
+#include <libjc/common.h>
+#include "rtfi.h"
+#include "recorder.h"
+#include "framereader.h"
+#include "player.h"
+#include "framebus.h"
+#include "pcminput.h"
+#include "batch.h"
+#include "imagefile.h"
+#include "videostream.h"
+#include "kernels.h"
+
+/* How often to check the control socket when no frames arrive */
+#define IDLE_MS 100
+#define MAX_CLIENTS 8
+#define CMD_LEN 128
+
+enum {OUT_NONE, OUT_TEXT, OUT_RAW};
+
+enum {OPT_RECORD, OPT_RECBITS, OPT_RECDELTA, OPT_PLAY, OPT_SPEED, OPT_START,
+	OPT_SHM, OPT_STDOUT, OPT_CONTROL, OPT_INPUT, OPT_FORMAT, OPT_CHANNELS,
+	OPT_RATE, OPT_REALTIME, OPT_BATCH, OPT_OUTDIR, OPT_JOBS, OPT_IMAGE,
+	OPT_MODE, OPT_CMAP, OPT_PEAK, OPT_RANGE, OPT_HEIGHT, OPT_BASEBAND,
+	OPT_SPAN, OPT_TZOOM, OPT_TMAX, OPT_LENGTH, OPT_TILE, OPT_VIDEO,
+	OPT_WIDTH, OPT_FPS, OPT_KERNELS, OPT_ARITH, OPT_DECIMATOR,
+	OPT_ALIGN, OPT_HOP, OPT_MAXHOP, OPT_REDUCER, OPT_HIGHPASS, OPT_SHELF,
+	OPT_SHELFDB, OPT_OCTAVEDB, OPT_HELP, N_OPTS};
+
+struct cmdline {
+	char *record;
+	int rec_bits;
+	int rec_delta;
+	char *play;
+	float speed;
+	double start;
+	char *shm;
+	char *input;
+	char *format;
+	int channels;
+	int rate;
+	int realtime;
+	char *out;
+	char *control;
+	char *batch;
+	char *out_dir;
+	int jobs;
+	char *image;
+	char *mode;
+	char *cmap;
+	float peak, range;
+	int height;
+	int base_band;
+	int span;
+	int tzoom;
+	int tmax;
+	double length;
+	int tile;
+	char *video;
+	int width;
+	int fps;
+	char *kernels;
+	char *arith;
+	char *decimator;
+	char *align;
+	float hop, max_hop;
+	char *reducer;
+	float highpass, shelf, shelf_db;
+	char *octave_db;
+};
+
+static volatile sig_atomic_t quit_requested;
+
+/* A control connection and the part of a command line read so far */
+struct client {
+	int fd;
+	size_t len;
+	char line[CMD_LEN];
+};
+
+static struct stats {
+	unsigned long frames, lagged;
+} stats;
+
+static int extra_arg(int i, char *value, void *data)
+{
+	(void)i;
+	(void)value;
+	(void)data;
+	return -PARSE_BADSYNTAX;
+}
+
+static int parse_cmdline(int argc, char *argv[], struct cmdline *cl)
+{
+	struct opt_rule rules[N_OPTS];
+
+	set_parse_str_nocopy(&rules[OPT_RECORD], &cl->record);
+	set_parse_meta(&rules[OPT_RECORD], 'r', "record",
+		"Record the ARTFI frames to a file");
+	set_parse_int(&rules[OPT_RECBITS], &cl->rec_bits);
+	set_parse_meta(&rules[OPT_RECBITS], PARSE_NO_SHORT, "record-bits",
+		"Bits per recorded sample, 8 (default) or 16");
+	set_parse_bool(&rules[OPT_RECDELTA], &cl->rec_delta);
+	set_parse_meta(&rules[OPT_RECDELTA], PARSE_NO_SHORT, "record-delta",
+		"Store recorded frames as differences with the previous one");
+	set_parse_str_nocopy(&rules[OPT_PLAY], &cl->play);
+	set_parse_meta(&rules[OPT_PLAY], 'p', "play",
+		"Read frames from a recorded file instead of the audio input");
+	set_parse_float(&rules[OPT_SPEED], &cl->speed);
+	set_parse_meta(&rules[OPT_SPEED], PARSE_NO_SHORT, "speed",
+		"Replay speed, 1 is real time (default), 0 as fast as possible");
+	set_parse_double(&rules[OPT_START], &cl->start);
+	set_parse_meta(&rules[OPT_START], PARSE_NO_SHORT, "start",
+		"Start replaying at this time (in seconds)");
+	set_parse_str_nocopy(&rules[OPT_SHM], &cl->shm);
+	set_parse_meta(&rules[OPT_SHM], 's', "shm",
+		"Publish the frames in a shared memory object (e.g. /rtfi)");
+	set_parse_str_nocopy(&rules[OPT_STDOUT], &cl->out);
+	set_parse_meta(&rules[OPT_STDOUT], 'o', "stdout",
+		"Write the frames (in dB) to stdout, as 'text' or 'raw' floats");
+	set_parse_str_nocopy(&rules[OPT_CONTROL], &cl->control);
+	set_parse_meta(&rules[OPT_CONTROL], 'c', "control",
+		"Accept commands on this UNIX socket");
+	set_parse_str_nocopy(&rules[OPT_INPUT], &cl->input);
+	set_parse_meta(&rules[OPT_INPUT], 'i', "input",
+		"Read raw PCM from a file or FIFO (- for stdin) instead of JACK");
+	set_parse_str_nocopy(&rules[OPT_FORMAT], &cl->format);
+	set_parse_meta(&rules[OPT_FORMAT], PARSE_NO_SHORT, "format",
+		"Input sample format: s16 (default), s32 or f32");
+	set_parse_int(&rules[OPT_CHANNELS], &cl->channels);
+	set_parse_meta(&rules[OPT_CHANNELS], PARSE_NO_SHORT, "channels",
+		"Input channels, mixed to mono (default 1)");
+	set_parse_int(&rules[OPT_RATE], &cl->rate);
+	set_parse_meta(&rules[OPT_RATE], PARSE_NO_SHORT, "rate",
+		"Input sample rate: 44100, 48000 (default) or 96000");
+	set_parse_bool(&rules[OPT_REALTIME], &cl->realtime);
+	set_parse_meta(&rules[OPT_REALTIME], PARSE_NO_SHORT, "realtime",
+		"Process the input at its sample rate, not as fast as possible");
+	set_parse_str_nocopy(&rules[OPT_BATCH], &cl->batch);
+	set_parse_meta(&rules[OPT_BATCH], 'b', "batch",
+		"Analyze the sound files in a directory, or listed in a file");
+	set_parse_str_nocopy(&rules[OPT_OUTDIR], &cl->out_dir);
+	set_parse_meta(&rules[OPT_OUTDIR], PARSE_NO_SHORT, "out-dir",
+		"Where to write the batch results (default: current directory)");
+	set_parse_int(&rules[OPT_JOBS], &cl->jobs);
+	set_parse_meta(&rules[OPT_JOBS], 'j', "jobs",
+		"Worker threads for batch and images (default: one per processor)");
+	set_parse_str_nocopy(&rules[OPT_IMAGE], &cl->image);
+	set_parse_meta(&rules[OPT_IMAGE], PARSE_NO_SHORT, "image",
+		"Render the replayed file (or each batch file) to PREFIX-N.ppm");
+	set_parse_str_nocopy(&rules[OPT_MODE], &cl->mode);
+	set_parse_meta(&rules[OPT_MODE], PARSE_NO_SHORT, "mode",
+		"Image mode: artfi (default), aes, pes, spes or npes");
+	set_parse_str_nocopy(&rules[OPT_CMAP], &cl->cmap);
+	set_parse_meta(&rules[OPT_CMAP], PARSE_NO_SHORT, "cmap",
+		"Image colormap: iris (default) or gray");
+	set_parse_float(&rules[OPT_PEAK], &cl->peak);
+	set_parse_meta(&rules[OPT_PEAK], PARSE_NO_SHORT, "peak",
+		"Level shown with the brightest color (default depends on mode)");
+	set_parse_float(&rules[OPT_RANGE], &cl->range);
+	set_parse_meta(&rules[OPT_RANGE], PARSE_NO_SHORT, "range",
+		"Levels shown below the peak (default depends on mode)");
+	set_parse_int(&rules[OPT_HEIGHT], &cl->height);
+	set_parse_meta(&rules[OPT_HEIGHT], PARSE_NO_SHORT, "height",
+		"Image height (default: one row per band)");
+	set_parse_int(&rules[OPT_BASEBAND], &cl->base_band);
+	set_parse_meta(&rules[OPT_BASEBAND], PARSE_NO_SHORT, "base-band",
+		"First band shown, 0 is the highest (default 0)");
+	set_parse_int(&rules[OPT_SPAN], &cl->span);
+	set_parse_meta(&rules[OPT_SPAN], PARSE_NO_SHORT, "span",
+		"Number of bands shown (default: all)");
+	set_parse_int(&rules[OPT_TZOOM], &cl->tzoom);
+	set_parse_meta(&rules[OPT_TZOOM], PARSE_NO_SHORT, "tzoom",
+		"Each image column summarizes 2^N frames (default 0)");
+	set_parse_bool(&rules[OPT_TMAX], &cl->tmax);
+	set_parse_meta(&rules[OPT_TMAX], PARSE_NO_SHORT, "tmax",
+		"Summarize the frames of a column with the max, not the mean");
+	set_parse_double(&rules[OPT_LENGTH], &cl->length);
+	set_parse_meta(&rules[OPT_LENGTH], PARSE_NO_SHORT, "length",
+		"Seconds to render from --start (default: up to the end)");
+	set_parse_int(&rules[OPT_TILE], &cl->tile);
+	set_parse_meta(&rules[OPT_TILE], PARSE_NO_SHORT, "tile",
+		"Maximum image width, longer ones are split (default 4096)");
+	set_parse_str_nocopy(&rules[OPT_VIDEO], &cl->video);
+	set_parse_meta(&rules[OPT_VIDEO], PARSE_NO_SHORT, "video",
+		"Write the scrolling image to stdout as 'y4m' or 'rgb' video");
+	set_parse_int(&rules[OPT_WIDTH], &cl->width);
+	set_parse_meta(&rules[OPT_WIDTH], PARSE_NO_SHORT, "width",
+		"Video width (default 800)");
+	set_parse_int(&rules[OPT_FPS], &cl->fps);
+	set_parse_meta(&rules[OPT_FPS], PARSE_NO_SHORT, "fps",
+		"Video frames per second (default 25)");
+	set_parse_str_nocopy(&rules[OPT_KERNELS], &cl->kernels);
+	set_parse_meta(&rules[OPT_KERNELS], PARSE_NO_SHORT, "kernels",
+		"Instruction set: auto (default), base, avx2 or avx512");
+	set_parse_str_nocopy(&rules[OPT_ARITH], &cl->arith);
+	set_parse_meta(&rules[OPT_ARITH], PARSE_NO_SHORT, "arith",
+		"Filterbank arithmetic: float (default) or q31 (fixed point)");
+	set_parse_str_nocopy(&rules[OPT_DECIMATOR], &cl->decimator);
+	set_parse_meta(&rules[OPT_DECIMATOR], PARSE_NO_SHORT, "decimator",
+		"Decimating filter: fir (default) or iir (allpass half-band)");
+	set_parse_str_nocopy(&rules[OPT_ALIGN], &cl->align);
+	set_parse_meta(&rules[OPT_ALIGN], PARSE_NO_SHORT, "align",
+		"Delay the octaves to match: none (default), decimators or full");
+	set_parse_float(&rules[OPT_HOP], &cl->hop);
+	set_parse_meta(&rules[OPT_HOP], PARSE_NO_SHORT, "hop",
+		"Time between frames, in ms (default 10)");
+	set_parse_float(&rules[OPT_MAXHOP], &cl->max_hop);
+	set_parse_meta(&rules[OPT_MAXHOP], PARSE_NO_SHORT, "max-hop",
+		"Average the lower octaves over up to this many ms");
+	set_parse_str_nocopy(&rules[OPT_REDUCER], &cl->reducer);
+	set_parse_meta(&rules[OPT_REDUCER], PARSE_NO_SHORT, "reducer",
+		"Power of each band in a frame: mean (default) or max");
+	set_parse_float(&rules[OPT_HIGHPASS], &cl->highpass);
+	set_parse_meta(&rules[OPT_HIGHPASS], PARSE_NO_SHORT, "highpass",
+		"High pass the input from this frequency, in Hz");
+	set_parse_float(&rules[OPT_SHELF], &cl->shelf);
+	set_parse_meta(&rules[OPT_SHELF], PARSE_NO_SHORT, "shelf",
+		"Low shelf the input below this frequency, in Hz");
+	set_parse_float(&rules[OPT_SHELFDB], &cl->shelf_db);
+	set_parse_meta(&rules[OPT_SHELFDB], PARSE_NO_SHORT, "shelf-db",
+		"Gain of the low shelf in dB (negative to cut)");
+	set_parse_str_nocopy(&rules[OPT_OCTAVEDB], &cl->octave_db);
+	set_parse_meta(&rules[OPT_OCTAVEDB], PARSE_NO_SHORT, "octave-db",
+		"Gains of the octaves in dB, the top one first: G,G,...");
+	set_parse_help(&rules[OPT_HELP]);
+	set_parse_meta(&rules[OPT_HELP], 'h', "help", "Show this help");
+
+	return generic_parser(argc, argv, new_conf(rules, N_OPTS,
+		"rtfi analyzer (no display), by Juan I Carrano\n"
+		"Usage: rtfid [options]\n",
+		1, extra_arg, cl));
+}
+
+static void on_signal(int sig)
+{
+	(void)sig;
+	quit_requested = 1;
+}
+
+static int write_frame(int format, const float *db)
+{ /* Write a frame (in dB) to stdout. Returns -E_OTHER if stdout is gone */
+	int i;
+
+	if (format == OUT_RAW) {
+		if (fwrite(db, sizeof(*db), ARTFI_BSIZE, stdout) != ARTFI_BSIZE)
+			return -E_OTHER;
+	} else {
+		for (i = 0; i < ARTFI_BSIZE; i++)
+			printf((i + 1 < ARTFI_BSIZE)? "%.2f " : "%.2f\n", db[i]);
+		if (ferror(stdout))
+			return -E_OTHER;
+	}
+
+	return -E_OK;
+}
+
+static int control_open(const char *path)
+{ /* Returns a listening socket, or -1 */
+	struct sockaddr_un addr;
+	struct stat st;
+	int fd;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(path) >= sizeof(addr.sun_path))
+		return -1;
+	strcpy(addr.sun_path, path);
+
+	if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		return -1;
+
+	/* a stale socket from a previous run; anything else makes bind fail */
+	if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+		unlink(path);
+	if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+	    || listen(fd, MAX_CLIENTS) != 0) {
+		close(fd);
+		return -1;
+	}
+	fcntl(fd, F_SETFL, O_NONBLOCK);
+
+	return fd;
+}
+
+static void control_reply(int fd, const char *reply)
+{
+	if (write(fd, reply, strlen(reply)) < 0)
+		PERROR("control: write failed\n");
+}
+
+static void control_command(int fd, char *cmd)
+{ /* Execute a command line and write the reply */
+	char reply[CMD_LEN * 2];
+
+	cmd[strcspn(cmd, "\r\n")] = '\0';
+
+	if (strcmp(cmd, "status") == 0) {
+		snprintf(reply, sizeof(reply), "frames %lu lagged %lu\n",
+						stats.frames, stats.lagged);
+	} else if (strcmp(cmd, "quit") == 0) {
+		quit_requested = 1;
+		snprintf(reply, sizeof(reply), "ok\n");
+	} else if (strcmp(cmd, "help") == 0) {
+		snprintf(reply, sizeof(reply), "commands: status quit help\n");
+	} else {
+		snprintf(reply, sizeof(reply), "unknown command: %s\n", cmd);
+	}
+
+	control_reply(fd, reply);
+}
+
+static void control_input(struct client *c, const char *data, size_t len)
+{ /* Append what was read to the line buffer and run every complete line */
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if (data[i] != '\n') {
+			if (c->len < sizeof(c->line) - 1)
+				c->line[c->len] = data[i];
+			/* keep counting, to tell an overlong line */
+			if (c->len < sizeof(c->line))
+				c->len++;
+			continue;
+		}
+		if (c->len < sizeof(c->line)) {
+			c->line[c->len] = '\0';
+			control_command(c->fd, c->line);
+		} else {
+			control_reply(c->fd, "command too long\n");
+		}
+		c->len = 0;
+	}
+}
+
+static void control_poll(int lfd, struct client *clients, int timeout)
+{ /* Accept connections and run the commands received, one per line */
+	struct pollfd fds[MAX_CLIENTS + 1];
+	struct client *owner[MAX_CLIENTS + 1];
+	nfds_t i, n = 0;
+
+	fds[n].fd = lfd;
+	fds[n++].events = POLLIN;
+	for (i = 0; i < MAX_CLIENTS; i++) {
+		if (clients[i].fd >= 0) {
+			owner[n] = &clients[i];
+			fds[n].fd = clients[i].fd;
+			fds[n++].events = POLLIN;
+		}
+	}
+
+	if (poll(fds, n, timeout) <= 0)
+		return;
+
+	for (i = 1; i < n; i++) {
+		struct client *c = owner[i];
+		char data[CMD_LEN];
+		ssize_t len;
+
+		if (!fds[i].revents)
+			continue;
+
+		len = read(c->fd, data, sizeof(data));
+		if (len > 0) {
+			control_input(c, data, (size_t)len);
+			continue;
+		}
+
+		/* A last command without a newline still gets run */
+		if (len == 0 && c->len > 0)
+			control_input(c, "\n", 1);
+		close(c->fd);
+		c->fd = -1;
+	}
+
+	if (fds[0].revents & POLLIN) {
+		int cfd = accept(lfd, NULL, NULL);
+
+		for (i = 0; cfd >= 0 && i < MAX_CLIENTS; i++) {
+			if (clients[i].fd < 0) {
+				clients[i].fd = cfd;
+				clients[i].len = 0;
+				cfd = -1;
+			}
+		}
+		if (cfd >= 0)
+			close(cfd);
+	}
+}
+
+static int wait_frame(sem_t *sem, int timeout_ms)
+{ /* Returns 1 if a frame is available */
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_nsec += timeout_ms * 1000000L;
+	ts.tv_sec += ts.tv_nsec / 1000000000;
+	ts.tv_nsec %= 1000000000;
+
+	return sem_timedwait(sem, &ts) == 0;
+}
+
+static void run(sem_t *sem, int format, struct video *video, int lfd)
+{ /* Take frames until asked to quit, or until the input ends */
+	struct client clients[MAX_CLIENTS];
+	unsigned int read_p = ARTFI_DELAY - 1;
+	int i;
+
+	for (i = 0; i < MAX_CLIENTS; i++)
+		clients[i].fd = -1;
+
+	while (!quit_requested) {
+		if (wait_frame(sem, IDLE_MS)) {
+			float frame[ARTFI_BSIZE], db[ARTFI_BSIZE];
+			int sv;
+
+			INCMOD(read_p, ARTFI_DELAY);
+			memcpy(frame, rtfi_blocks[read_p], sizeof(frame));
+			/* Same as in image_run: skip frames that may have been
+			 * overwritten */
+			sem_getvalue(sem, &sv);
+			if (sv >= (ARTFI_DELAY - 1)) {
+				stats.lagged++;
+			} else {
+				stats.frames++;
+				if (format != OUT_NONE || video != NULL)
+					kern->db(db, frame, ARTFI_BSIZE, 20);
+				if (format != OUT_NONE
+				    && write_frame(format, db) != -E_OK)
+					quit_requested = 1;
+				if (video != NULL
+				    && video_push(video, db) != -E_OK)
+					quit_requested = 1;
+			}
+		} else if (rtfi_input_ended() && rtfi_pending() == 0) {
+			break;
+		}
+
+		if (lfd >= 0)
+			control_poll(lfd, clients, 0);
+	}
+
+	for (i = 0; i < MAX_CLIENTS; i++)
+		if (clients[i].fd >= 0)
+			close(clients[i].fd);
+}
+
+static int select_kernels(const char *name)
+{ /* Pick the kernels and tell which ones */
+	int r = kernels_select(name);
+
+	if (r == -E_BADARGS)
+		PERROR("Unknown kernels: %s\n", name);
+	else if (r == -E_BADCFG)
+		PERROR("This processor does not support the %s kernels\n", name);
+	else
+		PERROR("Using the %s kernels\n", kern->name);
+
+	return r;
+}
+
+static int select_filterbank(const struct cmdline *cl)
+{ /* Arithmetic, decimator, alignment, hop, reducer and equalizer of the
+	engines */
+	struct rtfi_eq eq;
+	int arith = rtfi_arith(cl->arith), dec = rtfi_decimator(cl->decimator);
+	int align = rtfi_align(cl->align), red = rtfi_reducer(cl->reducer);
+
+	if (arith < 0) {
+		PERROR("Unknown arithmetic: %s\n", cl->arith);
+		return -E_BADARGS;
+	}
+	if (dec < 0) {
+		PERROR("Unknown decimator: %s\n", cl->decimator);
+		return -E_BADARGS;
+	}
+	if (align < 0) {
+		PERROR("Unknown alignment: %s\n", cl->align);
+		return -E_BADARGS;
+	}
+	/* the others are not a power, or not one plane */
+	if (red != RTFI_MEAN && red != RTFI_MAX) {
+		PERROR("The reducer must be mean or max: %s\n", cl->reducer);
+		return -E_BADARGS;
+	}
+	if (!(cl->hop > 0 && cl->hop <= 1000)) {
+		PERROR("The hop must be between 0 and 1000 ms\n");
+		return -E_BADARGS;
+	}
+	if (rtfi_eq_octaves(&eq, cl->octave_db) != -E_OK) {
+		PERROR("Bad octave gains: %s\n", cl->octave_db);
+		return -E_BADARGS;
+	}
+	eq.highpass_hz = cl->highpass;
+	eq.shelf_hz = cl->shelf;
+	eq.shelf_db = cl->shelf_db;
+	if (arith == RTFI_Q31 && dec == RTFI_IIR) {
+		PERROR("The IIR decimator is not available in fixed point\n");
+		return -E_BADARGS;
+	}
+
+	rtfi_default_arith = arith;
+	rtfi_default_decimator = dec;
+	rtfi_default_align = align;
+	rtfi_default_hop_ms = cl->hop;
+	rtfi_default_max_hop_ms = cl->max_hop;
+	rtfi_default_reducer = red;
+	rtfi_default_eq = eq;
+	return -E_OK;
+}
+
+static int input_config(const struct cmdline *cl, struct rtfi_input_cfg *in)
+{ /* Fill in the PCM input configuration */
+	in->backend = RTFI_IN_PCM;
+	in->path = cl->input;
+	in->channels = cl->channels;
+	in->sample_rate = cl->rate;
+	in->realtime = cl->realtime;
+
+	if ((in->format = pcm_format(cl->format)) < 0) {
+		PERROR("Unknown sample format: %s\n", cl->format);
+		return -E_BADARGS;
+	}
+
+	return -E_OK;
+}
+
+static int image_config(const struct cmdline *cl, struct image_cfg *img)
+{ /* Fill in the image options. The time range is set by the caller. */
+	int cmap;
+
+	memset(img, 0, sizeof(*img));
+
+	if ((img->mode = render_mode(cl->mode)) < 0) {
+		PERROR("Unknown mode: %s\n", cl->mode);
+		return -E_BADARGS;
+	}
+	if ((cmap = render_cmap(cl->cmap)) < 0) {
+		PERROR("Unknown colormap: %s\n", cl->cmap);
+		return -E_BADARGS;
+	}
+	img->cmap = (unsigned int)cmap;
+
+	img->prefix = cl->image;
+	img->contrast = default_contrast[img->mode];
+	if (!isnan(cl->peak))
+		img->contrast.peak = cl->peak;
+	if (!isnan(cl->range))
+		img->contrast.range = cl->range;
+	img->rows = cl->height? cl->height : REAL_N_BANDS;
+	img->base = cl->base_band;
+	img->span = cl->span? cl->span : REAL_N_BANDS;
+	img->fpool = RS_MAX;
+	img->tzoom = cl->tzoom;
+	img->tpool = cl->tmax? IMG_MAX : IMG_MEAN;
+	img->tile_w = cl->tile;
+	img->jobs = cl->jobs? cl->jobs : (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (img->rows < 1 || img->span < 1 || img->tile_w < 1
+	    || img->tzoom < 0 || img->tzoom > 30) {
+		PERROR("Bad image size or zoom\n");
+		return -E_BADARGS;
+	}
+
+	return -E_OK;
+}
+
+static int video_config(const struct cmdline *cl, struct video_cfg *vc)
+{ /* The image options apply to the video too */
+	struct image_cfg img;
+	int r;
+
+	if ((r = image_config(cl, &img)) != -E_OK)
+		return r;
+
+	if ((vc->format = video_format(cl->video)) < 0) {
+		PERROR("Unknown video format: %s\n", cl->video);
+		return -E_BADARGS;
+	}
+	if (cl->out != NULL) {
+		PERROR("--video and --stdout cannot be used together\n");
+		return -E_BADARGS;
+	}
+
+	vc->width = cl->width;
+	vc->rows = img.rows;
+	vc->base = img.base;
+	vc->span = img.span;
+	vc->fpool = img.fpool;
+	vc->mode = img.mode;
+	vc->cmap = img.cmap;
+	vc->contrast = img.contrast;
+	vc->fps = cl->fps;
+
+	return -E_OK;
+}
+
+static int run_image(const struct cmdline *cl, const struct image_cfg *cfg)
+{ /* Render the replay file */
+	struct image_cfg img = *cfg;
+	struct ff_reader rd;
+	int r;
+
+	if ((r = ff_open(&rd, cl->play)) != -E_OK)
+		return r;
+
+	img.start = ff_time2frame(&rd, cl->start);
+	if (cl->length > 0)
+		img.end = ff_time2frame(&rd, cl->start + cl->length);
+	r = image_export(&rd, &img);
+	ff_close(&rd);
+
+	return r;
+}
+
+static int run_batch(const struct cmdline *cl, const struct image_cfg *img)
+{
+	struct batch_cfg cfg;
+
+	cfg.out_dir = cl->out_dir;
+	cfg.jobs = cl->jobs? cl->jobs : (int)sysconf(_SC_NPROCESSORS_ONLN);
+	cfg.qbits = cl->rec_bits;
+	cfg.delta = cl->rec_delta;
+	cfg.channels = cl->channels;
+	cfg.sample_rate = cl->rate;
+	cfg.image = img;
+
+	if ((cfg.format = pcm_format(cl->format)) < 0) {
+		PERROR("Unknown sample format: %s\n", cl->format);
+		return -E_BADARGS;
+	}
+
+	return batch_run(cl->batch, &cfg);
+}
+
+int main(int argc, char *argv[])
+{
+	int r = 0, format = OUT_NONE, lfd = -1;
+	void *client = NULL;
+	sem_t sem;
+	struct recorder *rec = NULL;
+	struct ff_reader replay;
+	struct player *player = NULL;
+	struct framebus bus, *busp = NULL;
+	int sample_rate, hop;
+	struct sigaction sa;
+	struct rtfi_input_cfg input = {RTFI_IN_JACK};
+	struct image_cfg img;
+	struct video_cfg vc;
+	struct video *video = NULL;
+	struct cmdline cl = {NULL, 8, 0, NULL, 1, 0, NULL, NULL, "s16", 1, 48000,
+				0, NULL, NULL, NULL, ".", 0, NULL, "artfi",
+				"iris", NAN, NAN, 0, 0, 0, 0, 0, 0, IMG_TILE_W,
+				NULL, 800, 25, NULL, "float", "fir", "none",
+				BLK_SIZE_MS, 0, "mean",
+				0, 0, 0, ""};
+
+	if ((r = parse_cmdline(argc, argv, &cl)) < PARSE_OK) {
+		r = (r == -PARSE_REQHELP)? -E_DONEHELP : -E_BADARGS;
+		goto not_configured;
+	}
+
+	if ((r = select_kernels(cl.kernels)) != -E_OK
+	    || (r = select_filterbank(&cl)) != -E_OK)
+		goto not_configured;
+
+	if (cl.out != NULL) {
+		if (strcmp(cl.out, "text") == 0) {
+			format = OUT_TEXT;
+		} else if (strcmp(cl.out, "raw") == 0) {
+			format = OUT_RAW;
+		} else {
+			PERROR("Unknown output format: %s\n", cl.out);
+			r = -E_BADARGS;
+			goto not_configured;
+		}
+	}
+
+	if (cl.input != NULL && (r = input_config(&cl, &input)) != -E_OK)
+		goto not_configured;
+
+	if (cl.image != NULL) {
+		if ((r = image_config(&cl, &img)) != -E_OK)
+			goto not_configured;
+		if (cl.batch == NULL && cl.play == NULL) {
+			PERROR("--image needs --play or --batch\n");
+			r = -E_BADARGS;
+			goto not_configured;
+		}
+	}
+
+	if (cl.video != NULL && (r = video_config(&cl, &vc)) != -E_OK)
+		goto not_configured;
+
+	if (cl.batch != NULL) {
+		r = run_batch(&cl, (cl.image != NULL)? &img : NULL);
+		goto not_configured;
+	}
+
+	if (cl.image != NULL) {
+		r = run_image(&cl, &img);
+		goto not_configured;
+	}
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = on_signal;
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	/* a closed stdout or control client must not kill us */
+	sa.sa_handler = SIG_IGN;
+	sigaction(SIGPIPE, &sa, NULL);
+
+	if (sem_init(&sem, 0, 0) != 0) {
+		r = errno;
+		goto sem_disaster;
+	}
+
+	if (cl.play != NULL) {
+		if ((r = ff_open(&replay, cl.play)) != -E_OK)
+			goto rtfi_disaster;
+		rtfi_set_output(&sem);
+		sample_rate = (int)replay.hdr->sample_rate;
+		hop = (int)replay.hdr->hop;
+	} else {
+		client = rtfi_prepare(&r, &sem, &input);
+		if (client == NULL) {
+			r = -E_OTHER;
+			goto rtfi_disaster;
+		}
+		sample_rate = rtfi_samplerate();
+		hop = rtfi_hop();
+	}
+
+	if (cl.record != NULL) {
+		rec = recorder_open(cl.record, cl.rec_bits, cl.rec_delta,
+					sample_rate, hop, &r);
+		if (rec == NULL)
+			goto sink_disaster;
+		rtfi_add_queued_sink(recorder_push, recorder_room, rec);
+	}
+
+	if (cl.shm != NULL) {
+		if ((r = framebus_create(&bus, cl.shm, sample_rate, hop))
+								!= -E_OK)
+			goto sink_disaster;
+		busp = &bus;
+		rtfi_add_sink(framebus_push, busp);
+	}
+
+	if (cl.video != NULL) {
+		video = video_open(stdout, &vc, (double)sample_rate / hop, &r);
+		if (video == NULL)
+			goto sink_disaster;
+	}
+
+	if (cl.control != NULL && (lfd = control_open(cl.control)) < 0) {
+		PERROR("Cannot listen on %s\n", cl.control);
+		r = -E_OTHER;
+		goto sink_disaster;
+	}
+
+	if (cl.play != NULL) {
+		player = player_start(&replay, ff_time2frame(&replay, cl.start),
+							cl.speed, &r);
+		if (player == NULL)
+			goto start_disaster;
+	} else if ((r = rtfi_launch(client)) != 0) {
+		r = -E_OTHER;
+		goto start_disaster;
+	}
+
+	run(&sem, format, video, lfd);
+
+	if (player != NULL)
+		player_stop(player);
+
+start_disaster:
+	if (lfd >= 0) {
+		close(lfd);
+		unlink(cl.control);
+	}
+sink_disaster:
+	if (client != NULL)
+		rtfi_unload(client);
+	if (cl.play != NULL)
+		ff_close(&replay);
+	/* the audio thread (or the player) is stopped, so it is safe to close
+	 * the sinks */
+	if (rec != NULL)
+		recorder_close(rec);
+	if (busp != NULL)
+		framebus_close(busp);
+	if (video != NULL)
+		video_close(video);
+	fflush(stdout);
+rtfi_disaster:
+	sem_destroy(&sem);
+sem_disaster:
+not_configured:
+	return -r;
+}
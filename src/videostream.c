@@ -0,0 +1,191 @@
+/*
+ * videostream.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <libjc/common.h>
+#include "videostream.h"
+
+static const char *const formatnames[N_VIDEO_FORMATS] = {
+	[VIDEO_Y4M] = "y4m",
+	[VIDEO_RGB] = "rgb",
+};
+
+struct video {
+	FILE *out;
+	struct video_cfg cfg;
+	struct resampler rs;
+	struct pipeline pipe;
+	intensity_t *col;
+	/* bytes of each plane for every intensity level */
+	unsigned char pal[INTENSITY_LEVELS][3];
+	/* Y4M has three planes of one byte per pixel, RGB one of three */
+	int n_planes, bpp;
+	/* plane p, row y, column x is at ((p*rows + y)*width + x)*bpp */
+	unsigned char *fb;
+	/* oldest column, which is the next one to be replaced */
+	int head;
+	double frame_rate, acc;
+};
+
+int video_format(const char *name)
+{
+	int i;
+
+	for (i = 0; i < N_VIDEO_FORMATS; i++)
+		if (strcasecmp(formatnames[i], name) == 0)
+			return i;
+
+	return -1;
+}
+
+static void build_palette(struct video *v)
+{
+	struct RGB col[INTENSITY_LEVELS];
+	int i;
+
+	render_palette(col, v->cfg.mode, &v->cfg.contrast, v->cfg.cmap);
+
+	for (i = 0; i < INTENSITY_LEVELS; i++) {
+		float r = col[i].r, g = col[i].g, b = col[i].b;
+
+		if (v->cfg.format == VIDEO_Y4M) {
+			v->pal[i][0] = (unsigned char)(16.5f + (65.738f*r
+					+ 129.057f*g + 25.064f*b) / 256);
+			v->pal[i][1] = (unsigned char)(128.5f + (-37.945f*r
+					- 74.494f*g + 112.439f*b) / 256);
+			v->pal[i][2] = (unsigned char)(128.5f + (112.439f*r
+					- 94.154f*g - 18.285f*b) / 256);
+		} else {
+			v->pal[i][0] = col[i].r;
+			v->pal[i][1] = col[i].g;
+			v->pal[i][2] = col[i].b;
+		}
+	}
+}
+
+static void put_column(struct video *v, int x)
+{ /* Convert the levels in v->col to pixels in column x */
+	const size_t W = (size_t)v->cfg.width, rows = (size_t)v->cfg.rows;
+	const size_t bpp = (size_t)v->bpp;
+	size_t p, y;
+
+	for (p = 0; p < (size_t)v->n_planes; p++) {
+		unsigned char *dst = v->fb + (p*rows*W + (size_t)x)*bpp;
+
+		for (y = 0; y < rows; y++, dst += W*bpp)
+			memcpy(dst, v->pal[v->col[y]] + p*bpp, bpp);
+	}
+}
+
+static int write_frame(struct video *v)
+{
+	const size_t W = (size_t)v->cfg.width, rows = (size_t)v->cfg.rows;
+	const size_t bpp = (size_t)v->bpp, head = (size_t)v->head;
+	const unsigned char *row = v->fb;
+	size_t y;
+
+	if (v->cfg.format == VIDEO_Y4M)
+		fputs("FRAME\n", v->out);
+
+	for (y = 0; y < (size_t)v->n_planes * rows; y++, row += W*bpp) {
+		fwrite(row + head*bpp, bpp, W - head, v->out);
+		fwrite(row, bpp, head, v->out);
+	}
+
+	return (fflush(v->out) != 0 || ferror(v->out))? -E_OTHER : -E_OK;
+}
+
+struct video *video_open(FILE *out, const struct video_cfg *cfg,
+					double frame_rate, int *ecode)
+{
+	struct video *v;
+	int r = -E_NOMEM, x;
+
+	if (cfg->width < 1 || cfg->rows < 1 || cfg->fps < 1
+	    || cfg->format < 0 || cfg->format >= N_VIDEO_FORMATS) {
+		r = -E_BADCFG;
+		goto no_video;
+	}
+
+	if (__CALLOC(v) == NULL)
+		goto no_video;
+
+	v->out = out;
+	v->cfg = *cfg;
+	v->frame_rate = frame_rate;
+	v->n_planes = (cfg->format == VIDEO_Y4M)? 3 : 1;
+	v->bpp = (cfg->format == VIDEO_Y4M)? 1 : 3;
+
+	if (NMALLOC(v->col, (size_t)cfg->rows) == NULL
+	    || NMALLOC(v->fb, (size_t)cfg->width * (size_t)cfg->rows * 3)
+								== NULL)
+		goto free_video;
+
+	if ((r = resampler_init(&v->rs, cfg->rows, REAL_N_BANDS, cfg->base,
+				cfg->span, cfg->fpool)) != -E_OK)
+		goto free_video;
+
+	build_palette(v);
+	pipeline_reset(&v->pipe);
+
+	/* start with an empty image */
+	memset(v->col, 0, (size_t)cfg->rows * sizeof(*v->col));
+	for (x = 0; x < cfg->width; x++)
+		put_column(v, x);
+
+	if (cfg->format == VIDEO_Y4M)
+		fprintf(out, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n",
+						cfg->width, cfg->rows, cfg->fps);
+
+	*ecode = -E_OK;
+	return v;
+
+free_video:
+	video_close(v);
+no_video:
+	*ecode = r;
+	return NULL;
+}
+
+int video_push(struct video *v, const float *db)
+{
+	int r = -E_OK;
+
+	render_column(&v->pipe, db, v->cfg.mode, &v->rs, v->col, 1);
+	put_column(v, v->head);
+	v->head = (v->head + 1) % v->cfg.width;
+
+	for (v->acc += v->cfg.fps; v->acc >= v->frame_rate && r == -E_OK;
+						v->acc -= v->frame_rate)
+		r = write_frame(v);
+
+	return r;
+}
+
+void video_close(struct video *v)
+{
+	resampler_free(&v->rs);
+	free(v->col);
+	free(v->fb);
+	free(v);
+}
@@ -0,0 +1,70 @@
+/*
+ * videostream.h
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+#ifndef _VIDEOSTREAM_H_
+#define _VIDEOSTREAM_H_
+
+#include <stdio.h>
+#include "render.h"
+
+/* Write the scrolling image, as the visualizer shows it, as a video stream.
+ *
+ * Each ARTFI frame is rendered as one column and converted to pixels once,
+ * into a framebuffer used as a ring of columns. Writing a video frame only
+ * copies the framebuffer out, starting at the oldest column. Video frames
+ * are produced at a fixed rate measured in ARTFI frames (i.e. in the time of
+ * the input, not of the clock), so replays at any speed give the same video.
+ *
+ * VIDEO_Y4M is YUV4MPEG2 with 4:4:4 BT.601 (limited range) samples, and
+ * VIDEO_RGB is headerless packed 24 bit RGB. */
+
+enum VIDEO_FORMATS {VIDEO_Y4M, VIDEO_RGB, N_VIDEO_FORMATS};
+
+struct video_cfg {
+	int format;
+	int width, rows;
+	/* bands shown (see resample.h) */
+	double base, span;
+	int fpool;
+	int mode;
+	unsigned int cmap;
+	struct contrast contrast;
+	/* video frames per second */
+	int fps;
+};
+
+struct video;
+
+/* Format number from its name ("y4m" or "rgb"), or -1 */
+extern int video_format(const char *name);
+
+/* frame_rate is the number of ARTFI frames per second. Returns NULL on error,
+ * with the error code in *ecode. */
+extern struct video *video_open(FILE *out, const struct video_cfg *cfg,
+					double frame_rate, int *ecode);
+
+/* Add a frame (in dB) and write the video frames that are due. Returns
+ * -E_OTHER if the output failed. */
+extern int video_push(struct video *v, const float *db);
+
+extern void video_close(struct video *v);
+
+#endif /* _VIDEOSTREAM_H_ */
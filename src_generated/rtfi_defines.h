@@ -10,5 +10,7 @@
 #define LOWF_IGNORE (N_BANDS - REAL_N_BANDS)
 #define BOTTOM_MINIDEX 60
 #define DFILTER_N 32
+#define APF_N 4
+#define RTFI_N_CONFIGS 3
 
 #endif /* __src_generated_rtfi_defines_h__ */ /* End of automatically generated definitions */
@@ -0,0 +1,137 @@
+/* Kernels specialized for the built-in configurations, see src/kernels.h.
+Included by src/kernels.c, once for each instruction set.
+Automatically generated file. DO NOT edit */
+#include "rtfi_defines.h"
+
+static void decimate_44100(const float *restrict src, int j0, int n,
+							float *restrict dst)
+{
+	int o;
+
+	for (o = j0 / 2; o < (n + 1) / 2; o++) {
+		const float *s = src + 2*o;
+
+		dst[o] = -0.0000071145815716f*(s[0] + s[-31])
+			+ -0.0000521952799505f*(s[-1] + s[-30])
+			+ 0.0001775674451008f*(s[-2] + s[-29])
+			+ 0.0004564905792836f*(s[-3] + s[-28])
+			+ -0.0009980039496648f*(s[-4] + s[-27])
+			+ -0.0019536851823251f*(s[-5] + s[-26])
+			+ 0.0035242891469081f*(s[-6] + s[-25])
+			+ 0.0059688125339571f*(s[-7] + s[-24])
+			+ -0.0096225554535832f*(s[-8] + s[-23])
+			+ -0.0149394032297121f*(s[-9] + s[-22])
+			+ 0.0225948936981368f*(s[-10] + s[-21])
+			+ 0.0337488622201586f*(s[-11] + s[-20])
+			+ -0.0507869709382441f*(s[-12] + s[-19])
+			+ -0.0798739024129755f*(s[-13] + s[-18])
+			+ 0.1437469605311303f*(s[-14] + s[-17])
+			+ 0.4480159548733517f*(s[-15] + s[-16]);
+	}
+}
+
+static void decimate_48000(const float *restrict src, int j0, int n,
+							float *restrict dst)
+{
+	int o;
+
+	for (o = j0 / 2; o < (n + 1) / 2; o++) {
+		const float *s = src + 2*o;
+
+		dst[o] = -0.0000022737817980f*(s[0] + s[-31])
+			+ -0.0000238981732067f*(s[-1] + s[-30])
+			+ 0.0000961840590825f*(s[-2] + s[-29])
+			+ 0.0002790451340019f*(s[-3] + s[-28])
+			+ -0.0006712079748282f*(s[-4] + s[-27])
+			+ -0.0014212276714032f*(s[-5] + s[-26])
+			+ 0.0027378978411544f*(s[-6] + s[-25])
+			+ 0.0049013726219765f*(s[-7] + s[-24])
+			+ -0.0082805569827768f*(s[-8] + s[-23])
+			+ -0.0133715347655487f*(s[-9] + s[-22])
+			+ 0.0208939397323450f*(s[-10] + s[-21])
+			+ 0.0320452229976618f*(s[-11] + s[-20])
+			+ -0.0492338950653878f*(s[-12] + s[-19])
+			+ -0.0786264977954098f*(s[-13] + s[-18])
+			+ 0.1429387604484560f*(s[-14] + s[-17])
+			+ 0.4477386693756811f*(s[-15] + s[-16]);
+	}
+}
+
+static void decimate_96000(const float *restrict src, int j0, int n,
+							float *restrict dst)
+{
+	int o;
+
+	for (o = j0 / 2; o < (n + 1) / 2; o++) {
+		const float *s = src + 2*o;
+
+		dst[o] = -0.0000000032776999f*(s[0] + s[-31])
+			+ -0.0000002926491736f*(s[-1] + s[-30])
+			+ 0.0000030238624850f*(s[-2] + s[-29])
+			+ 0.0000173318676343f*(s[-3] + s[-28])
+			+ -0.0000714492884698f*(s[-4] + s[-27])
+			+ -0.0002355970500020f*(s[-5] + s[-26])
+			+ 0.0006577114199466f*(s[-6] + s[-25])
+			+ 0.0016104196576150f*(s[-7] + s[-24])
+			+ -0.0035444941051343f*(s[-8] + s[-23])
+			+ -0.0071473432210147f*(s[-9] + s[-22])
+			+ 0.0134271155058800f*(s[-10] + s[-21])
+			+ 0.0239143016707962f*(s[-11] + s[-20])
+			+ -0.0413091814918073f*(s[-12] + s[-19])
+			+ -0.0719337740968565f*(s[-13] + s[-18])
+			+ 0.1384524617610055f*(s[-14] + s[-17])
+			+ 0.4461597694347955f*(s[-15] + s[-16]);
+	}
+}
+
+static void resonate_block(const float *restrict ar, const float *restrict ai,
+		const float *restrict k, float *restrict yr, float *restrict yi,
+		const float *restrict src, int n, float *restrict acc)
+{ /* Bands 0 to 120. The complex product is written out so that it is
+	computed exactly as k*x + a1*y would be. */
+	int i, b;
+
+	for (b = 0; b < 120; b++)
+		acc[b] = 0;
+
+	for (i = 0; i < n; i++) {
+		const float x = src[i];
+
+		for (b = 0; b < 120; b++) {
+			float re = k[b]*x + (ar[b]*yr[b] - ai[b]*yi[b]);
+			float im = ar[b]*yi[b] + ai[b]*yr[b];
+
+			yr[b] = re;
+			yi[b] = im;
+			acc[b] += re*re + im*im;
+		}
+	}
+}
+
+static void resonate_bottom(const float *restrict ar, const float *restrict ai,
+		const float *restrict k, float *restrict yr, float *restrict yi,
+		const float *restrict src, int n, float *restrict acc)
+{ /* Bands 60 to 120. The complex product is written out so that it is
+	computed exactly as k*x + a1*y would be. */
+	int i, b;
+
+	for (b = 60; b < 120; b++)
+		acc[b] = 0;
+
+	for (i = 0; i < n; i++) {
+		const float x = src[i];
+
+		for (b = 60; b < 120; b++) {
+			float re = k[b]*x + (ar[b]*yr[b] - ai[b]*yi[b]);
+			float im = ar[b]*yi[b] + ai[b]*yr[b];
+
+			yr[b] = re;
+			yi[b] = im;
+			acc[b] += re*re + im*im;
+		}
+	}
+}
+
+#define RTFI_DECIMATE_CONFIGS { decimate_44100, decimate_48000, decimate_96000 }
+
+/* End of automatically generated file */
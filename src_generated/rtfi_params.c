@@ -33,6 +33,7 @@ const int RTFI_SAMPLERATES[3] = { 44100.0000000000000000f, 48000.000000000000000
 
 struct rtfi_param {
 	float decfilter[DFILTER_N / 2]; /* we use an even, symmetric FIR */
+	float apfilter[APF_N]; /* or the allpass half-band, see rtfi.py */
 	complex float a1[BLOCK];
 	float k[BLOCK];
 };
@@ -46,6 +47,9 @@ static const struct rtfi_param rtfi_44100 =
 	-0.0507869709382441f, -0.0798739024129755f, 0.1437469605311303f,
 	0.4480159548733517f
 	},
+	.apfilter = { 0.0497881011451681f, 0.1943204578051991f, 0.4278080823862326f,
+	0.7677354434545528f
+	},
 	.a1 = { 0.5833201026711543f + 0.8101001989572933f*I, 0.5788626211664529f +
 	0.8132789455150656f*I, 0.5743618460009497f + 0.8164513666584085f*I,
 	0.5698174618668959f + 0.8196170414222811f*I, 0.5652291538429937f +
@@ -179,6 +183,9 @@ static const struct rtfi_param rtfi_48000 =
 	-0.0492338950653878f, -0.0786264977954098f, 0.1429387604484560f,
 	0.4477386693756811f
 	},
+	.apfilter = { 0.0458944032484701f, 0.1818989034862095f, 0.4098532379211429f,
+	0.7564290463790442f
+	},
 	.a1 = { 0.6439394850211939f + 0.7629865876885099f*I, 0.6400808825350845f +
 	0.7662144528126087f*I, 0.6361836072008824f + 0.7694413334954138f*I,
 	0.6322473466367111f + 0.7726669120963342f*I, 0.6282717878229296f +
@@ -312,6 +319,9 @@ static const struct rtfi_param rtfi_96000 =
 	-0.0413091814918073f, -0.0719337740968565f, 0.1384524617610055f,
 	0.4461597694347955f
 	},
+	.apfilter = { 0.0340427884504610f, 0.1426391936026643f, 0.3498112491094599f,
+	0.7159856904032434f
+	},
 	.a1 = { 0.9061847231475405f + 0.4209884409871497f*I, 0.9051170236175041f +
 	0.4232681702031523f*I, 0.9040373539000057f + 0.4255583744278119f*I,
 	0.9029455844808943f + 0.4278590677978354f*I, 0.9018415845580154f +
@@ -435,4 +445,9 @@ static const struct rtfi_param rtfi_96000 =
 	0.0015705493167765f, 0.0015796402267749f, 0.0015887837163838f
 	},
 };
+
+/* Indexed by configuration id, the same as RTFI_SAMPLERATES */
+static const struct rtfi_param *const rtfi_configs[RTFI_N_CONFIGS] = {
+	&rtfi_44100, &rtfi_48000, &rtfi_96000
+};
 /* Automatically generated file ends here */
@@ -1,314 +1,1242 @@
-/* ISO226 Equal loudness contour.
-Calculated for 70.000000 phon. Interpolated using cubic splines.
+/* ISO226 Equal loudness contours.
+Weights of each level for the contours of 20 to 90 phon, interpolated using
+cubic splines, and zero at the minimum of the 70.000000 phon contour.
 Automatically generated file. DO NOT edit
-iso226[0] -> highest frequency */
+iso_weight[l][0] -> highest frequency */
 #include "rtfi_defines.h"
 #define N_HARM 10
 
 static const int hindex[N_HARM - 1] = {
 	120, 190, 240, 279, 310, 337, 360, 380, 399
 };
-static const float iso226[N_BANDS] = {
-	10.9730164468136167f, 10.8368440479941626f, 10.6999704227020089f,
-	10.5624321346919885f, 10.4242648979123942f, 10.2855035933051369f,
-	10.1461822852937473f, 10.0063342379651488f, 9.8659919309505568f,
-	9.7251911207750936f, 9.5839990078316077f, 9.4424962890142439f,
-	9.3007612846070629f, 9.1588698917561402f, 9.0168956398539137f,
-	8.8749097448061889f, 8.7329811622026341f, 8.5911766394121827f,
-	8.4495607666230939f, 8.3081960268477104f, 8.1671428449121777f,
-	8.0264596354495836f, 7.8862028499162165f, 7.7464270226488026f,
-	7.6071848159815829f, 7.4685270644407353f, 7.3305028180340202f,
-	7.1931593846528443f, 7.0565423716031717f, 6.9206957262828439f,
-	6.7856617760210867f, 6.6514812670960453f, 6.5181934029465083f,
-	6.3858358815931666f, 6.2544449322843434f, 6.1240553513814291f,
-	5.9947005374980904f, 5.8664125259085012f, 5.7392220222375272f,
-	5.6131584354477013f, 5.4882499101357780f, 5.3645233581527805f,
-	5.2420044895603013f, 5.1207178429357754f, 5.0006868150396002f,
-	4.8819336898561545f, 4.7644796670214049f, 4.6483448896481292f,
-	4.5335484715610761f, 4.4201082850988911f, 4.3080392558563148f,
-	4.1973544583424456f, 4.0880661419086977f, 3.9801857599117767f,
-	3.8737239911030628f, 3.7686907605563249f, 3.6650952601426923f,
-	3.5629459685618770f, 3.4622506709381469f, 3.3630164779898166f,
-	3.2652498447804561f, 3.1689565890604001f, 3.0741419092060482f,
-	2.9808104017655808f, 2.8889660786182390f, 2.7986123837553833f,
-	2.7097522096903219f, 2.6223879135045252f, 2.5365213325375890f,
-	2.4521537997274550f, 2.3692861586087588f, 2.2879187779750794f,
-	2.2080515662125464f, 2.1296839853110896f, 2.0528150645598231f,
-	1.9774434139327468f, 1.9035672371711598f, 1.8311843445687117f,
-	1.7602921654653443f, 1.6908877604554249f, 1.6229678333164799f,
-	1.5565287426636445f, 1.4915665133357123f, 1.4280768475179713f,
-	1.3660551356072546f, 1.3054964668243656f, 1.2463956395792906f,
-	1.1887471726856802f, 1.1325460072132216f, 1.0777886651434585f,
-	1.0244716401849701f, 0.9725910873480359f, 0.9221428342342648f,
-	0.8731223920642179f, 0.8255249664483841f, 0.7793454679068930f,
-	0.7345785221428969f, 0.6912184800745536f, 0.6492594276309660f,
-	0.6086951953163577f, 0.5695193675474286f, 0.5317252917687370f,
-	0.4953060873504569f, 0.4602546542728589f, 0.4265636816021896f,
-	0.3942256557620141f, 0.3632328686044985f, 0.3335774252852559f,
-	0.3052512519465154f, 0.2782461032120551f, 0.2525535694978487f,
-	0.2281650841427307f, 0.2050719303620667f, 0.1832652480289028f,
-	0.1627360402854379f, 0.1434751799890677f, 0.1254734159961117f,
-	0.1087213792863793f, 0.0932095889326519f, 0.0789284579174705f,
-	0.0658682988012202f, 0.0540193292440989f, 0.0433716773854655f,
-	0.0339153870831410f, 0.0256404230162985f, 0.0185366756539764f,
-	0.0125939660930214f, 0.0078020507675092f, 0.0041506260326543f,
-	0.0016307559319841f, 0.0002447803411343f, 0.0000000000000000f,
-	0.0009030912541164f, 0.0029600885963106f, 0.0061764030456146f,
-	0.0105568401189089f, 0.0161056174027578f, 0.0228263817336796f,
-	0.0307222259946656f, 0.0397957055354681f, 0.0500488542243289f,
-	0.0614832001382410f, 0.0740997808995587f, 0.0878991586650528f,
-	0.1028814347755684f, 0.1190462640721108f, 0.1363928688856930f,
-	0.1549200527071548f, 0.1746262135436751f, 0.1955093569679889f,
-	0.2175671088669304f, 0.2407967278949172f, 0.2651951176387257f,
-	0.2907588384993858f, 0.3174841192965943f, 0.3453668686017437f,
-	0.3744026858047675f, 0.4045868719205714f, 0.4359144401397828f,
-	0.4683801261298441f, 0.5019783980908841f, 0.5367034665717085f,
-	0.5725492940509014f, 0.6095096042875383f, 0.6475778914469004f,
-	0.6867474290048392f, 0.7270112784364784f, 0.7683622976928177f,
-	0.8107931494703280f, 0.8542997059574446f, 0.8989056776567566f,
-	0.9446474031255008f, 0.9915596223766556f, 1.0396754171826075f,
-	1.0890262542783518f, 1.1396420276394252f, 1.1915510998519636f,
-	1.2447803425927475f, 1.2993551762369577f, 1.3552996086104088f,
-	1.4126362729031996f, 1.4713864647612240f, 1.5315701785718403f,
-	1.5932061429592750f, 1.6563118555056207f, 1.7209036167125760f,
-	1.7869965632187643f, 1.8546047002877515f, 1.9237409335809019f,
-	1.9944171002290290f, 2.0666439992173622f, 2.1404314210969204f,
-	2.2157881770358614f, 2.2927221272239677f, 2.3712402086432576f,
-	2.4513484622169415f, 2.5330520593498420f, 2.6163553278716023f,
-	2.7012617773953735f, 2.7877741241032652f, 2.8758943149702390f,
-	2.9656235514375453f, 3.0569623125470144f, 3.1499103775468598f,
-	3.2444668479798082f, 3.3406301692639175f, 3.4383981517761413f,
-	3.5377678949415241f, 3.6386746548117799f, 3.7408903206655282f,
-	3.8441664786475798f, 3.9482626774821057f, 4.0529462429042979f,
-	4.1579920958770771f, 4.2631825745200871f, 4.3683072596804067f,
-	4.4731628040761962f, 4.5775527649438601f, 4.6812874401229010f,
-	4.7841837075120424f, 4.8860648678325020f, 4.9867604906350351f,
-	5.0861062634882757f, 5.1839438442878247f, 5.2801207166259303f,
-	5.3744900481628832f, 5.4669105519428882f, 5.5572463505969836f,
-	5.6453668433782553f, 5.7311465759741651f, 5.8144651130427008f,
-	5.8952069134197131f, 5.9732612079457965f, 6.0485218798620366f,
-	6.1208873477251871f, 6.1902604507929198f, 6.2565483368317985f,
-	6.3196623523006394f, 6.3795179348634150f, 6.4360345081858128f,
-	6.4891353789719517f, 6.5387476361966463f, 6.5848020524911419f,
-	6.6272329876398999f, 6.6659782941473509f, 6.7009792248341569f,
-	6.7321833898756154f, 6.7596111413069764f, 6.7833525676614812f,
-	6.8034989737387264f, 6.8201398260109301f, 6.8333627870058535f,
-	6.8432537490686087f, 6.8498968675129959f, 6.8533745931741521f,
-	6.8537677043719327f, 6.8511553382963086f, 6.8456150218248268f,
-	6.8372227017819682f, 6.8260527746506341f, 6.8121781157454109f,
-	6.7956701078569210f, 6.7765986693769946f, 6.7550322819137421f,
-	6.7310380174054956f, 6.7046815647426712f, 6.6760272559062628f,
-	6.6451380916314235f, 6.6120757666048888f, 6.5769006942042409f,
-	6.5396720307870879f, 6.5004476995387392f, 6.4592844138855980f,
-	6.4162377004820002f, 6.3713619217790693f, 6.3247102981814862f,
-	6.2763349298008535f, 6.2262868178121522f, 6.1746158854205788f,
-	6.1213709984455846f, 6.0665999855291659f, 6.0103496579748565f,
-	5.9526658292242018f, 5.8935933339769662f, 5.8331760469617961f,
-	5.7714569013631660f, 5.7084779069110425f, 5.6442801676391525f,
-	5.5789038993177087f, 5.5123968223892206f, 5.4448748912082152f,
-	5.3764847848616739f, 5.3073688237521139f, 5.2376648202927214f,
-	5.1675061835015157f, 5.0970220214662589f, 5.0263372417219330f,
-	4.9555726495794090f, 4.8848450444450862f, 4.8142673141693280f,
-	4.7439485274615691f, 4.6739940244088842f, 4.6045055051344121f,
-	4.5355811166310787f, 4.4673155378053764f, 4.3998000627658200f,
-	4.3331226823896998f, 4.2673681642007892f, 4.2026181305907500f,
-	4.1389511354160220f, 4.0764427390014362f, 4.0151655815810727f,
-	3.9551894552066216f, 3.8965813741527597f, 3.8394056438484085f,
-	3.7837239283626758f, 3.7295953164728814f, 3.6770763863426339f,
-	3.6262212688365167f, 3.5770817094980032f, 3.5297071292163338f,
-	3.4841446836079086f, 3.4404393211374469f, 3.3986338400027165f,
-	3.3587689438076609f, 3.3208832960470716f, 3.2850135734262409f,
-	3.2511944815448715f, 3.2194356819265124f, 3.1896834448100435f,
-	3.1618747884044609f, 3.1359482079340211f, 3.1118436453376717f,
-	3.0895024595478304f, 3.0688673973379252f, 3.0498825647280654f,
-	3.0324933989389677f, 3.0166466408835646f, 3.0022903081868861f,
-	2.9893736687240420f, 2.9778472146671220f, 2.9676626370314381f,
-	2.9587728007119125f, 2.9511317200007596f, 2.9446945345772093f,
-	2.9394174859610018f, 2.9352578944207721f, 2.9321741363288965f,
-	2.9301256219549430f, 2.9290727736890716f, 2.9289770046878090f,
-	2.9298006979342262f, 2.9315071857049304f, 2.9340607294361831f,
-	2.9374264999818251f, 2.9415705582559184f, 2.9464598362525720f,
-	2.9520621184362312f, 2.9583460234955794f, 2.9652809864540615f,
-	2.9728372411305628f, 2.9809858029436924f, 2.9896984520533465f,
-	2.9989477168329870f, 3.0087068576668088f, 3.0189498510655852f,
-	3.0296516685936723f, 3.0407946853910346f, 3.0523683831429622f,
-	3.0643627219660345f, 3.0767678388468198f, 3.0895740447024878f,
-	3.1027718214896112f, 3.1163518193609860f, 3.1303048538691485f,
-	3.1446219032160201f, 3.1592941055480850f, 3.1743127562959614f,
-	3.1896693055579419f, 3.2053553555268053f, 3.2213626579586929f,
-	3.2376831116841203f, 3.2543087601597165f, 3.2712317890604368f,
-	3.2884445239115507f, 3.3059394277593697f, 3.3237090988806131f,
-	3.3417462685294339f, 3.3600437987215201f, 3.3785946800547464f,
-	3.3973920295656086f, 3.4164290886211859f, 3.4356992208455779f,
-	3.4551959100806187f, 3.4749127583801140f, 3.4948434840371334f,
-	3.5149819196437591f, 3.5353220101827674f, 3.5558578111507018f,
-	3.5765834867119111f, 3.5974933078828144f, 3.6185816507462931f,
-	3.6398429946951154f, 3.6612719207045643f, 3.6828631096334021f,
-	3.7046113405526739f, 3.7265114891020659f, 3.7485585266784796f,
-	3.7707479315335775f, 3.7930763384662782f, 3.8155405953749693f,
-	3.8381375830734612f, 3.8608642151422146f, 3.8837174377764541f,
-	3.9066942296310998f, 3.9297916016628420f, 3.9530065969692174f,
-	3.9763362906250705f, 3.9997777895163154f, 4.0233282321713233f,
-	4.0469847885896115f, 4.0707446600686126f, 4.0946050790280140f,
-	4.1185633088321936f, 4.1426166436103529f, 4.1667624080752432f,
-	4.1909979573396328f, 4.2153206767314373f, 4.2397279816069329f,
-	4.2642173171627604f, 4.2887861582462392f, 4.3134320091644440f,
-	4.3381524034920602f, 4.3629449038779171f, 4.3878071018504698f,
-	4.4127366176223290f, 4.4377310998937389f, 4.4627882256550464f,
-	4.4879056999886302f, 4.5130812558698210f, 4.5383126539672531f,
-	4.5635976824425342f, 4.5889341567494313f, 4.6143199194324183f,
-	4.6397528399249239f, 4.6652308143470975f, 4.6907517653033040f,
-	4.7163136476768415f, 4.7419182488836213f, 4.7675774992806907f,
-	4.7933045821574325f, 4.8191121780635342f, 4.8450124772757874f,
-	4.8710171920027250f, 4.8971375683327807f, 4.9233843979301639f,
-	4.9497680294839341f, 4.9762983799149225f, 5.0029849453448065f,
-	5.0298368118326522f, 5.0568626658830027f, 5.0840708047298477f,
-	5.1114691464012623f, 5.1390652395687084f, 5.1668662731853061f,
-	5.1948790859171652f, 5.2231101753716871f, 5.2515657071272415f,
-	5.2802515235676708f, 5.3091731525255454f, 5.3383358157381480f,
-	5.3677444371196117f, 5.3974036508531356f, 5.4273178093062739f,
-	5.4574909907735645f, 5.4879270070491657f, 5.5186294108333129f,
-	5.5496015029758325f, 5.5808463395597698f, 5.6123667388283138f,
-	5.6441652879585291f, 5.6762443496842678f, 5.7086060687718714f,
-	5.7412523783511631f, 5.7741850061051281f, 5.8074054803203268f,
-	5.8409150167148169f, 5.8747119266212877f, 5.9087917366977081f,
-	5.9431498687410027f, 5.9777817612131940f, 6.0126828700053494f,
-	6.0478486691746411f, 6.0832746516545200f, 6.1189563299394081f,
-	6.1548892367439123f, 6.1910689256374383f, 6.2274909716546603f,
-	6.2641509718825858f, 6.3010445460246558f, 6.3381673369424334f,
-	6.3755150111754517f, 6.4130832594398726f, 6.4508677971061275f,
-	6.4888643646564219f, 6.5270687281225008f, 6.5654766795039734f,
-	6.6040840371679366f, 6.6428866462301386f, 6.6818803789182937f,
-	6.7210611349180454f, 6.7604248417017772f, 6.7999674548407967f,
-	6.8396849583016319f, 6.8795733647262267f, 6.9196287156971295f,
-	6.9598470819873910f, 7.0002245637962801f, 7.0407572909703333f,
-	7.0814414232111034f, 7.1222731502690664f, 7.1632486921246397f,
-	7.2043642991562535f, 7.2456162522962444f, 7.2870008631745264f,
-	7.3285144742504116f, 7.3701534589332596f, 7.4119142247456296f,
-	7.4537947789176826f, 7.4957971989597354f, 7.5379240596869010f,
-	7.5801777555126364f, 7.6225605055872165f, 7.6650743588219683f,
-	7.7077211988013232f, 7.7505027485849354f, 7.7934205754021946f,
-	7.8364760952408830f, 7.8796705773327034f, 7.9230051485372854f,
-	7.9664807976267440f, 8.0100983794730922f, 8.0538586191401578f,
-	8.0977621158821051f, 8.1418093470503123f, 8.1860006719104774f,
-	8.2303363353720300f, 8.2748164716312829f, 8.3194411077300572f,
-	8.3642101670318851f, 8.4091234726172388f, 8.4541807505991358f,
-	8.4993816333613239f, 8.5447256627202393f, 8.5902122930123852f,
-	8.6358408941086111f, 8.6816107543570240f, 8.7275210834556276f,
-	8.7735710152565076f, 8.8197596105025013f, 8.8660858594985683f,
-	8.9125486847181037f, 8.9591469433464823f, 9.0058794297626577f,
-	9.0527448779602793f, 9.0997419639093380f, 9.1468693078601717f,
-	9.1941254801910333f, 9.2415112853968822f, 9.2890335531224650f,
-	9.3366998027994157f, 9.3845171916925239f, 9.4324925244869462f,
-	9.4806322626682942f, 9.5289425336992366f, 9.5774291399968945f,
-	9.6260975677150640f, 9.6749529953347206f, 9.7240003020670258f,
-	9.7732440760721175f, 9.8226886224978074f, 9.8723379713412527f,
-	9.9221958851374268f, 9.9722658664778407f, 10.0225511653626427f,
-	10.0730547863896334f, 10.1237794957833245f, 10.1747278282672795f,
-	10.2259020937828922f, 10.2773043840575866f, 10.3289365790255232f,
-	10.3808003531036519f, 10.4328971813261830f, 10.4852283453402464f,
-	10.5377949392653676f, 10.5905978754198316f, 10.6436378899162776f,
-	10.6969155481293257f, 10.7504312500379058f, 10.8041852354446632f,
-	10.8581775890748844f, 10.9124082455576996f, 10.9668769942915247f,
-	11.0215834841964835f, 11.0765272283558289f, 11.1317076085487514f,
-	11.1871237504996799f, 11.2427717105051812f, 11.2986446033784773f,
-	11.3547355074557856f, 11.4110375945870999f, 11.4675441291697808f,
-	11.5242484671896932f, 11.5811440552691494f, 11.6382244297226833f,
-	11.6954832156193334f, 11.7529141258527829f, 11.8105109602182949f,
-	11.8682676044968360f, 11.9261780295468753f, 11.9842362904024640f,
-	12.0424365253793155f, 12.1007729551875656f, 12.1592398820517076f,
-	12.2178316888377339f, 12.2765428381871260f, 12.3353678716581925f,
-	12.3943014088742842f, 12.4533381466789734f, 12.5124728582983948f,
-	12.5717003925102944f, 12.6310156728203111f, 12.6904136966450949f,
-	12.7498895345020600f, 12.8094383292063867f, 12.8690552950747161f,
-	12.9287357171354529f, 12.9884749503462729f, 13.0482684188179263f,
-	13.1081116150452175f, 13.1680000991442370f, 13.2279294980966426f,
-	13.2878955050003640f, 13.3478938783269427f, 13.4079204411854960f,
-	13.4679727525211348f, 13.5280582612651870f, 13.5881876995924955f,
-	13.6483713556409896f, 13.7086190791722373f, 13.7689402928836699f,
-	13.8293440034790365f, 13.8898388125010683f, 13.9504329269313985f,
-	14.0111341695621974f, 14.0719499891438602f, 14.1328874703134488f,
-	14.1939533433079106f, 14.2551539934663936f, 14.3164954705259220f,
-	14.3779834977143679f, 14.4396234806448263f, 14.5014205160150595f,
-	14.5633794001164176f, 14.6255046371553448f, 14.6878004473916803f,
-	14.7502707750970643f, 14.8129192963372702f, 14.8757494265819048f,
-	14.9387643281446856f, 15.0019669174580343f, 15.0653598721850273f,
-	15.1289456381719845f, 15.1927264362451240f, 15.2567042688539232f,
-	15.3208809265649109f, 15.3852579944082066f, 15.4498368580802747f,
-	15.5146187100055215f, 15.5796045552598343f, 15.6447952173583786f,
-	15.7101913439109921f, 15.7757934121473369f, 15.8416017343147644f,
-	15.9076164629514096f, 15.9738375960369297f, 16.0402649820233876f,
-	16.1068983261049965f, 16.1737380541859181f, 16.2407867442068437f,
-	16.3080471210019340f, 16.3755216639076764f, 16.4432126139890329f,
-	16.5111219811028178f, 16.5792515508014873f, 16.6476028910802967f,
-	16.7161773589714642f, 16.7849761069879833f, 16.8540000894203530f,
-	16.9232500684890397f, 16.9927266203558389f, 17.0624301409965540f,
-	17.1323608519384010f, 17.2025188058642868f, 17.2729038920870721f,
-	17.3435158418962345f, 17.4143542337797186f, 17.4854184985234014f,
-	17.5567079241905333f, 17.6282216609841100f, 17.6999587259938522f,
-	17.7719180078308057f, 17.8440982711514238f, 17.9164981610738465f,
-	17.9891162074879958f, 18.0619508292623010f, 18.1350003383487604f,
-	18.2082629437886254f, 18.2817367556208978f, 18.3554197886951016f,
-	18.4293099663911164f, 18.5034051242474078f, 18.5777030134999137f,
-	18.6522013045328663f, 18.7268975902445618f, 18.8017893893284054f,
-	18.8768742439965962f, 18.9521517849245384f, 19.0276236437565558f,
-	19.1032913333679630f, 19.1791561585758217f, 19.2552192225322187f,
-	19.3314814329710885f, 19.4079435083116465f, 19.4846059836211509f,
-	19.5614692164403436f, 19.6385333924734340f, 19.7157985311464046f,
-	19.7932644910356146f, 19.8709309751696566f, 19.9487975362068966f,
-	20.0268635814914546f, 20.1051283779897432f, 20.1835910571104762f,
-	20.2622506194101391f, 20.3411059391864484f, 20.4201557689623030f,
-	20.4993987438619456f, 20.5788333858819925f, 20.6584581080597331f,
-	20.7382712185397651f, 20.8182709245426878f, 20.8984553362363528f,
-	20.9788224705123412f, 21.0593702546703128f, 21.1400965300105526f,
-	21.2209990553383108f, 21.3020755103806607f, 21.3833234991181058f,
-	21.4647405530329252f, 21.5463241342753662f, 21.6280716387503986f,
-	21.7099803991256266f, 21.7920476877628317f, 21.8742707195744259f,
-	21.9566471958056013f, 22.0391779454842407f, 22.1218647904957351f,
-	22.2047093423187505f, 22.2877130065886462f, 22.3708769894225412f,
-	22.4542023035985494f, 22.5376897745940710f, 22.6213400464839651f,
-	22.7051535877029380f, 22.7891306966742064f, 22.8732715073074644f,
-	22.9575759943682982f, 23.0420439787225035f, 23.1266751324571089f,
-	23.2114689838809483f, 23.2964249224072830f, 23.3815422033208051f,
-	23.4668199524313366f, 23.5522571706167980f, 23.6378527382572798f,
-	23.7236054195630715f, 23.8095138667982269f, 23.8955766244022669f,
-	23.9817921330119646f, 24.0681587333851752f, 24.1546746702289568f,
-	24.2413380959339548f, 24.3281470742167016f, 24.4150995836722444f,
-	24.5021935212383823f, 24.5894267055741835f, 24.6767968803535638f,
-	24.7643017174764708f, 24.8519388201995213f, 24.9397057261866877f,
-	25.0275999104831328f, 25.1156187884129878f, 25.2037597184026652f,
-	25.2920200047318104f, 25.3803969002128724f, 25.4688878738894715f,
-	25.5574960979113115f, 25.6462300491389499f, 25.7350979974635266f,
-	25.8241077818166360f, 25.9132668218658182f, 26.0025821294546091f,
-	26.0920603197914716f, 26.1817076223930911f, 26.2715298917867699f,
-	26.3615326179764793f, 26.4517209366776598f, 26.5420996393249879f,
-	26.6326731828577579f, 26.7234456992876233f, 26.8144210050523242f,
-	26.9056026101605141f, 26.9969937271311125f, 27.0885972797319852f,
-	27.1804159115213082f, 27.2724519941960324f, 27.3647076357512447f,
-	27.4571846884540207f, 27.5498847566358194f, 27.6428092043067579f,
-	27.7359591625956057f, 27.8293355370189346f, 27.9229390145827807f,
-	28.0167700707205256f, 28.1108289760698256f, 28.2051158030923546f,
-	28.2996304325393311f, 28.3943725597658130f, 28.4893417008971852f,
-	28.5845371988507395f, 28.6799582292150177f, 28.7756038059903716f,
-	28.8714727871930705f, 28.9675638803261251f, 29.0638756477194136f,
-	29.1604066503708310f, 29.2571584768994057f, 29.3541356157321900f,
-	29.4513423468031448f, 29.5487826110937988f, 29.6464600204942457f,
-	29.7443778674429637f, 29.8425391343493942f, 29.9409465028041382f,
-	30.0396023625802115f, 30.1385088204305305f, 30.2376677086849242f,
-	30.3370805936513079f, 30.4367487838245410f, 30.5366733379070894f,
-	30.6368550726452469f, 30.7372945704845790f, 30.8379921870483145f,
-	30.9389480584424916f, 31.0401621083907031f, 31.1416340552030420f,
-	31.2433634185812679f, 31.3453495262647408f, 31.4475915205195804f,
-	31.5500883644748455f, 31.6528388483081784f, 31.7558415952847923f,
-	31.8590950676521061f, 31.9625975723936193f, 32.0663472668444314f,
-	32.1703421641714300f, 32.2745801387212339f, 32.3790589312381343f,
-	32.4837761539550485f, 32.5887292955601708f, 32.6939157260414248f,
-	32.7993327014122826f, 32.9049773683200613f, 33.0108467685404037f,
-	33.1169387998562712f, 33.2232568856694286f, 33.3298061999102941f,
-	33.4365915391568933f, 33.5436173302330900f, 33.6508876409361903f,
-	33.7584061905237718f, 33.8661763599647543f, 33.9742012019589339f,
-	34.0824834507302938f, 34.1910255315981857f, 34.2998295703309140f,
-	34.4088974022862999f, 34.5182305813433743f, 34.6278303886291496f
+
+/* Rows of levels of 1 dB SPL from ISO_LEVEL0, columns of the bands of each
+ * semitone (and the next one below the last) */
+#define ISO_LEVEL0 14
+#define ISO_ROWS 100
+#define ISO_COLS 91
+
+static const float iso_weight[ISO_ROWS][ISO_COLS] = {
+	{-2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f,
+	 -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f, -2.756f},
+	{-1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.772f, -2.132f, -2.351f, -2.444f, -2.426f,
+	 -2.304f, -2.077f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f,
+	 -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f, -1.756f},
+	{-0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -1.163f, -1.678f, -2.040f, -2.261f, -2.358f, -2.343f,
+	 -2.224f, -2.001f, -1.674f, -1.247f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f,
+	 -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f, -0.756f},
+	{0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, -0.385f,
+	 -1.070f, -1.587f, -1.951f, -2.175f, -2.275f, -2.263f, -2.147f,
+	 -1.927f, -1.603f, -1.180f, -0.655f, -0.018f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f, 0.244f,
+	 0.244f, 0.244f, 0.244f, 0.244f},
+	{1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 0.569f, -0.294f,
+	 -0.980f, -1.500f, -1.865f, -2.092f, -2.194f, -2.185f, -2.073f,
+	 -1.856f, -1.535f, -1.114f, -0.592f, 0.045f, 0.800f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.244f, 1.244f, 1.244f},
+	{2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 1.705f, 0.656f, -0.207f,
+	 -0.893f, -1.415f, -1.782f, -2.012f, -2.117f, -2.111f, -2.001f,
+	 -1.787f, -1.469f, -1.051f, -0.530f, 0.106f, 0.863f, 1.735f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.244f},
+	{3.244f, 3.244f, 3.244f, 3.244f, 3.026f, 1.789f, 0.742f, -0.122f,
+	 -0.809f, -1.332f, -1.702f, -1.934f, -2.041f, -2.038f, -1.932f,
+	 -1.721f, -1.405f, -0.989f, -0.471f, 0.165f, 0.924f, 1.801f, 2.727f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.190f, 3.094f, 3.118f, 3.241f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f},
+	{4.244f, 4.244f, 4.244f, 4.244f, 3.105f, 1.870f, 0.824f, -0.039f,
+	 -0.728f, -1.253f, -1.624f, -1.858f, -1.968f, -1.968f, -1.864f,
+	 -1.656f, -1.343f, -0.930f, -0.413f, 0.223f, 0.984f, 1.865f, 2.797f,
+	 3.648f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.217f,
+	 3.788f, 3.428f, 3.191f, 3.095f, 3.119f, 3.244f, 3.451f, 3.725f,
+	 4.057f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f},
+	{5.244f, 5.244f, 5.244f, 4.590f, 3.181f, 1.949f, 0.904f, 0.040f,
+	 -0.649f, -1.175f, -1.549f, -1.785f, -1.898f, -1.900f, -1.799f,
+	 -1.593f, -1.283f, -0.871f, -0.356f, 0.279f, 1.042f, 1.927f, 2.865f,
+	 3.722f, 4.405f, 4.863f, 5.092f, 5.118f, 4.963f, 4.650f, 4.226f,
+	 3.793f, 3.429f, 3.191f, 3.095f, 3.120f, 3.247f, 3.455f, 3.732f,
+	 4.066f, 4.447f, 4.868f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f},
+	{6.244f, 6.244f, 6.211f, 4.659f, 3.255f, 2.026f, 0.981f, 0.118f,
+	 -0.573f, -1.101f, -1.476f, -1.714f, -1.829f, -1.834f, -1.736f,
+	 -1.533f, -1.224f, -0.815f, -0.301f, 0.334f, 1.098f, 1.988f, 2.932f,
+	 3.792f, 4.476f, 4.929f, 5.146f, 5.159f, 4.991f, 4.666f, 4.235f,
+	 3.797f, 3.430f, 3.191f, 3.095f, 3.121f, 3.249f, 3.459f, 3.737f,
+	 4.072f, 4.455f, 4.878f, 5.332f, 5.812f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f},
+	{7.244f, 7.244f, 6.273f, 4.727f, 3.326f, 2.100f, 1.057f, 0.193f,
+	 -0.499f, -1.028f, -1.406f, -1.646f, -1.763f, -1.770f, -1.674f,
+	 -1.474f, -1.168f, -0.760f, -0.248f, 0.387f, 1.153f, 2.046f, 2.996f,
+	 3.861f, 4.545f, 4.992f, 5.199f, 5.199f, 5.018f, 4.683f, 4.245f,
+	 3.801f, 3.432f, 3.191f, 3.095f, 3.122f, 3.250f, 3.461f, 3.740f,
+	 4.077f, 4.462f, 4.885f, 5.341f, 5.822f, 6.324f, 6.839f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f},
+	{8.244f, 7.968f, 6.333f, 4.792f, 3.396f, 2.172f, 1.130f, 0.266f,
+	 -0.427f, -0.957f, -1.337f, -1.580f, -1.699f, -1.708f, -1.615f,
+	 -1.416f, -1.112f, -0.706f, -0.195f, 0.439f, 1.206f, 2.103f, 3.058f,
+	 3.927f, 4.612f, 5.054f, 5.251f, 5.238f, 5.045f, 4.700f, 4.254f,
+	 3.806f, 3.433f, 3.191f, 3.094f, 3.122f, 3.251f, 3.462f, 3.743f,
+	 4.080f, 4.466f, 4.890f, 5.347f, 5.829f, 6.332f, 6.849f, 7.385f,
+	 7.951f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f},
+	{9.244f, 8.020f, 6.391f, 4.855f, 3.463f, 2.242f, 1.200f, 0.336f,
+	 -0.357f, -0.889f, -1.270f, -1.515f, -1.637f, -1.648f, -1.557f,
+	 -1.360f, -1.058f, -0.654f, -0.144f, 0.490f, 1.258f, 2.159f, 3.118f,
+	 3.991f, 4.676f, 5.113f, 5.300f, 5.275f, 5.071f, 4.716f, 4.264f,
+	 3.810f, 3.435f, 3.191f, 3.094f, 3.121f, 3.251f, 3.463f, 3.744f,
+	 4.082f, 4.468f, 4.893f, 5.350f, 5.833f, 6.336f, 6.854f, 7.391f,
+	 7.958f, 8.565f, 9.214f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f},
+	{9.713f, 8.070f, 6.447f, 4.917f, 3.529f, 2.310f, 1.269f, 0.405f,
+	 -0.289f, -0.822f, -1.206f, -1.452f, -1.576f, -1.590f, -1.501f,
+	 -1.306f, -1.006f, -0.603f, -0.094f, 0.539f, 1.309f, 2.213f, 3.177f,
+	 4.053f, 4.738f, 5.171f, 5.348f, 5.312f, 5.097f, 4.733f, 4.273f,
+	 3.815f, 3.436f, 3.191f, 3.093f, 3.120f, 3.250f, 3.463f, 3.744f,
+	 4.082f, 4.468f, 4.893f, 5.351f, 5.834f, 6.337f, 6.855f, 7.392f,
+	 7.960f, 8.568f, 9.220f, 9.910f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f},
+	{9.756f, 8.119f, 6.502f, 4.977f, 3.592f, 2.375f, 1.336f, 0.472f,
+	 -0.223f, -0.758f, -1.143f, -1.391f, -1.517f, -1.533f, -1.446f,
+	 -1.253f, -0.954f, -0.553f, -0.046f, 0.588f, 1.359f, 2.265f, 3.234f,
+	 4.113f, 4.798f, 5.226f, 5.395f, 5.348f, 5.122f, 4.749f, 4.283f,
+	 3.820f, 3.438f, 3.191f, 3.092f, 3.119f, 3.249f, 3.462f, 3.743f,
+	 4.081f, 4.466f, 4.891f, 5.349f, 5.831f, 6.334f, 6.851f, 7.388f,
+	 7.957f, 8.566f, 9.219f, 9.912f, 10.640f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f},
+	{9.798f, 8.166f, 6.555f, 5.035f, 3.654f, 2.440f, 1.401f, 0.537f,
+	 -0.159f, -0.695f, -1.081f, -1.332f, -1.460f, -1.478f, -1.392f,
+	 -1.201f, -0.904f, -0.505f, 0.002f, 0.635f, 1.407f, 2.316f, 3.289f,
+	 4.171f, 4.857f, 5.280f, 5.441f, 5.384f, 5.148f, 4.766f, 4.293f,
+	 3.825f, 3.440f, 3.190f, 3.091f, 3.118f, 3.248f, 3.460f, 3.741f,
+	 4.078f, 4.463f, 4.888f, 5.344f, 5.825f, 6.328f, 6.844f, 7.381f,
+	 7.949f, 8.558f, 9.212f, 9.908f, 10.639f, 11.398f, 12.178f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f},
+	{9.838f, 8.212f, 6.606f, 5.092f, 3.715f, 2.502f, 1.465f, 0.601f,
+	 -0.096f, -0.633f, -1.022f, -1.274f, -1.404f, -1.424f, -1.340f,
+	 -1.151f, -0.856f, -0.457f, 0.048f, 0.682f, 1.454f, 2.366f, 3.342f,
+	 4.228f, 4.913f, 5.332f, 5.485f, 5.418f, 5.172f, 4.782f, 4.303f,
+	 3.830f, 3.441f, 3.190f, 3.090f, 3.116f, 3.246f, 3.458f, 3.738f,
+	 4.074f, 4.459f, 4.882f, 5.337f, 5.817f, 6.318f, 6.834f, 7.369f,
+	 7.936f, 8.545f, 9.200f, 9.897f, 10.630f, 11.392f, 12.175f, 12.977f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f},
+	{9.878f, 8.256f, 6.656f, 5.147f, 3.773f, 2.563f, 1.527f, 0.662f,
+	 -0.035f, -0.574f, -0.964f, -1.218f, -1.350f, -1.371f, -1.290f,
+	 -1.102f, -0.808f, -0.411f, 0.094f, 0.727f, 1.501f, 2.415f, 3.395f,
+	 4.283f, 4.968f, 5.383f, 5.528f, 5.452f, 5.197f, 4.798f, 4.312f,
+	 3.835f, 3.443f, 3.190f, 3.089f, 3.114f, 3.243f, 3.455f, 3.734f,
+	 4.069f, 4.452f, 4.874f, 5.328f, 5.806f, 6.306f, 6.820f, 7.353f,
+	 7.919f, 8.527f, 9.182f, 9.880f, 10.614f, 11.378f, 12.164f, 12.970f,
+	 13.797f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f},
+	{9.915f, 8.300f, 6.705f, 5.201f, 3.831f, 2.623f, 1.587f, 0.723f,
+	 0.024f, -0.515f, -0.907f, -1.163f, -1.297f, -1.320f, -1.240f, -1.054f,
+	 -0.761f, -0.365f, 0.139f, 0.772f, 1.546f, 2.463f, 3.446f, 4.336f,
+	 5.022f, 5.433f, 5.570f, 5.485f, 5.221f, 4.815f, 4.322f, 3.840f,
+	 3.445f, 3.190f, 3.087f, 3.112f, 3.240f, 3.451f, 3.729f, 4.063f,
+	 4.445f, 4.865f, 5.316f, 5.793f, 6.290f, 6.803f, 7.334f, 7.898f,
+	 8.505f, 9.159f, 9.856f, 10.591f, 11.357f, 12.145f, 12.954f, 13.785f,
+	 14.638f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f},
+	{9.952f, 8.342f, 6.753f, 5.253f, 3.887f, 2.681f, 1.646f, 0.782f,
+	 0.082f, -0.459f, -0.852f, -1.110f, -1.245f, -1.270f, -1.192f, -1.007f,
+	 -0.716f, -0.321f, 0.182f, 0.815f, 1.591f, 2.510f, 3.495f, 4.388f,
+	 5.073f, 5.480f, 5.611f, 5.517f, 5.245f, 4.831f, 4.332f, 3.846f,
+	 3.447f, 3.189f, 3.085f, 3.110f, 3.237f, 3.447f, 3.724f, 4.056f,
+	 4.436f, 4.854f, 5.303f, 5.778f, 6.273f, 6.782f, 7.312f, 7.874f,
+	 8.478f, 9.131f, 9.828f, 10.563f, 11.329f, 12.118f, 12.929f, 13.763f,
+	 14.620f, 15.497f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f},
+	{9.988f, 8.383f, 6.799f, 5.304f, 3.941f, 2.737f, 1.704f, 0.839f,
+	 0.139f, -0.403f, -0.798f, -1.057f, -1.195f, -1.221f, -1.145f, -0.961f,
+	 -0.671f, -0.277f, 0.225f, 0.858f, 1.634f, 2.555f, 3.544f, 4.438f,
+	 5.124f, 5.527f, 5.651f, 5.549f, 5.268f, 4.847f, 4.343f, 3.851f,
+	 3.449f, 3.189f, 3.084f, 3.107f, 3.234f, 3.442f, 3.717f, 4.048f,
+	 4.425f, 4.841f, 5.288f, 5.760f, 6.252f, 6.759f, 7.286f, 7.845f,
+	 8.448f, 9.098f, 9.794f, 10.528f, 11.294f, 12.084f, 12.896f, 13.732f,
+	 14.592f, 15.474f, 16.376f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f},
+	{10.022f, 8.422f, 6.845f, 5.354f, 3.995f, 2.793f, 1.760f, 0.895f,
+	 0.195f, -0.349f, -0.745f, -1.006f, -1.145f, -1.174f, -1.099f, -0.916f,
+	 -0.627f, -0.234f, 0.268f, 0.900f, 1.677f, 2.600f, 3.591f, 4.488f,
+	 5.173f, 5.573f, 5.690f, 5.580f, 5.291f, 4.863f, 4.353f, 3.856f,
+	 3.451f, 3.188f, 3.082f, 3.104f, 3.230f, 3.437f, 3.710f, 4.039f,
+	 4.414f, 4.827f, 5.271f, 5.740f, 6.229f, 6.733f, 7.257f, 7.813f,
+	 8.413f, 9.061f, 9.755f, 10.488f, 11.253f, 12.042f, 12.855f, 13.692f,
+	 14.554f, 15.440f, 16.348f, 17.279f, 18.233f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f},
+	{10.055f, 8.461f, 6.889f, 5.403f, 4.047f, 2.847f, 1.815f, 0.950f,
+	 0.249f, -0.296f, -0.693f, -0.957f, -1.097f, -1.127f, -1.053f, -0.873f,
+	 -0.584f, -0.192f, 0.309f, 0.941f, 1.719f, 2.644f, 3.637f, 4.536f,
+	 5.220f, 5.617f, 5.728f, 5.611f, 5.314f, 4.879f, 4.363f, 3.862f,
+	 3.453f, 3.188f, 3.080f, 3.101f, 3.225f, 3.431f, 3.703f, 4.029f,
+	 4.401f, 4.812f, 5.253f, 5.718f, 6.204f, 6.705f, 7.225f, 7.778f,
+	 8.375f, 9.020f, 9.711f, 10.442f, 11.206f, 11.994f, 12.806f, 13.644f,
+	 14.508f, 15.396f, 16.308f, 17.244f, 18.205f, 19.188f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f},
+	{10.088f, 8.499f, 6.932f, 5.450f, 4.098f, 2.900f, 1.869f, 1.004f,
+	 0.302f, -0.244f, -0.643f, -0.908f, -1.050f, -1.082f, -1.009f, -0.829f,
+	 -0.542f, -0.151f, 0.350f, 0.982f, 1.760f, 2.687f, 3.682f, 4.582f,
+	 5.267f, 5.660f, 5.765f, 5.641f, 5.337f, 4.895f, 4.373f, 3.868f,
+	 3.455f, 3.187f, 3.078f, 3.098f, 3.221f, 3.425f, 3.694f, 4.018f,
+	 4.388f, 4.795f, 5.233f, 5.695f, 6.177f, 6.674f, 7.190f, 7.740f,
+	 8.333f, 8.975f, 9.663f, 10.392f, 11.153f, 11.940f, 12.751f, 13.588f,
+	 14.453f, 15.342f, 16.257f, 17.197f, 18.164f, 19.154f, 20.165f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f},
+	{10.119f, 8.536f, 6.974f, 5.497f, 4.148f, 2.952f, 1.921f, 1.057f,
+	 0.354f, -0.193f, -0.594f, -0.860f, -1.004f, -1.037f, -0.966f, -0.787f,
+	 -0.501f, -0.110f, 0.390f, 1.022f, 1.801f, 2.729f, 3.727f, 4.628f,
+	 5.312f, 5.702f, 5.802f, 5.670f, 5.359f, 4.911f, 4.384f, 3.873f,
+	 3.457f, 3.187f, 3.076f, 3.094f, 3.216f, 3.418f, 3.685f, 4.007f,
+	 4.373f, 4.777f, 5.211f, 5.670f, 6.148f, 6.641f, 7.153f, 7.699f,
+	 8.288f, 8.926f, 9.611f, 10.336f, 11.095f, 11.879f, 12.689f, 13.525f,
+	 14.389f, 15.280f, 16.196f, 17.140f, 18.111f, 19.107f, 20.126f,
+	 21.165f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f},
+	{10.150f, 8.572f, 7.016f, 5.543f, 4.197f, 3.003f, 1.973f, 1.109f,
+	 0.405f, -0.143f, -0.545f, -0.813f, -0.959f, -0.993f, -0.923f, -0.746f,
+	 -0.460f, -0.070f, 0.429f, 1.062f, 1.841f, 2.770f, 3.770f, 4.673f,
+	 5.356f, 5.743f, 5.837f, 5.699f, 5.382f, 4.927f, 4.394f, 3.879f,
+	 3.459f, 3.186f, 3.073f, 3.091f, 3.211f, 3.411f, 3.676f, 3.995f,
+	 4.358f, 4.758f, 5.188f, 5.643f, 6.117f, 6.605f, 7.113f, 7.655f,
+	 8.240f, 8.873f, 9.555f, 10.277f, 11.031f, 11.813f, 12.620f, 13.455f,
+	 14.318f, 15.208f, 16.125f, 17.071f, 18.046f, 19.047f, 20.073f,
+	 21.120f, 22.185f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f},
+	{10.179f, 8.607f, 7.056f, 5.587f, 4.244f, 3.053f, 2.024f, 1.159f,
+	 0.455f, -0.094f, -0.498f, -0.767f, -0.914f, -0.950f, -0.882f, -0.705f,
+	 -0.421f, -0.031f, 0.468f, 1.100f, 1.880f, 2.811f, 3.812f, 4.716f,
+	 5.399f, 5.783f, 5.872f, 5.728f, 5.404f, 4.943f, 4.404f, 3.885f,
+	 3.461f, 3.186f, 3.071f, 3.087f, 3.205f, 3.404f, 3.666f, 3.982f,
+	 4.341f, 4.738f, 5.164f, 5.614f, 6.084f, 6.568f, 7.071f, 7.608f,
+	 8.188f, 8.818f, 9.495f, 10.212f, 10.963f, 11.742f, 12.546f, 13.378f,
+	 14.239f, 15.128f, 16.045f, 16.992f, 17.970f, 18.975f, 20.006f,
+	 21.060f, 22.134f, 23.222f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f},
+	{10.208f, 8.642f, 7.096f, 5.631f, 4.291f, 3.101f, 2.074f, 1.209f,
+	 0.504f, -0.046f, -0.451f, -0.722f, -0.871f, -0.908f, -0.841f, -0.665f,
+	 -0.381f, 0.008f, 0.506f, 1.139f, 1.919f, 2.851f, 3.854f, 4.759f,
+	 5.441f, 5.823f, 5.907f, 5.756f, 5.426f, 4.959f, 4.415f, 3.890f,
+	 3.463f, 3.185f, 3.068f, 3.083f, 3.200f, 3.396f, 3.655f, 3.968f,
+	 4.324f, 4.716f, 5.138f, 5.584f, 6.049f, 6.529f, 7.027f, 7.559f,
+	 8.134f, 8.759f, 9.431f, 10.144f, 10.891f, 11.665f, 12.466f, 13.295f,
+	 14.153f, 15.040f, 15.957f, 16.904f, 17.883f, 18.891f, 19.926f,
+	 20.986f, 22.067f, 23.165f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f},
+	{10.237f, 8.675f, 7.135f, 5.674f, 4.338f, 3.149f, 2.122f, 1.258f,
+	 0.553f, 0.001f, -0.406f, -0.678f, -0.828f, -0.867f, -0.800f, -0.626f,
+	 -0.343f, 0.046f, 0.544f, 1.176f, 1.957f, 2.890f, 3.895f, 4.800f,
+	 5.482f, 5.861f, 5.940f, 5.784f, 5.448f, 4.975f, 4.425f, 3.896f,
+	 3.465f, 3.184f, 3.066f, 3.079f, 3.194f, 3.388f, 3.644f, 3.954f,
+	 4.306f, 4.694f, 5.112f, 5.553f, 6.013f, 6.488f, 6.981f, 7.508f,
+	 8.078f, 8.697f, 9.364f, 10.072f, 10.814f, 11.584f, 12.380f, 13.206f,
+	 14.061f, 14.945f, 15.860f, 16.807f, 17.786f, 18.796f, 19.834f,
+	 20.898f, 21.985f, 23.091f, 24.213f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f},
+	{10.264f, 8.708f, 7.173f, 5.717f, 4.383f, 3.197f, 2.170f, 1.306f,
+	 0.600f, 0.047f, -0.361f, -0.635f, -0.786f, -0.826f, -0.761f, -0.587f,
+	 -0.305f, 0.083f, 0.581f, 1.214f, 1.995f, 2.928f, 3.935f, 4.841f,
+	 5.523f, 5.899f, 5.973f, 5.812f, 5.469f, 4.990f, 4.436f, 3.902f,
+	 3.467f, 3.184f, 3.063f, 3.074f, 3.188f, 3.379f, 3.633f, 3.939f,
+	 4.287f, 4.671f, 5.084f, 5.520f, 5.975f, 6.445f, 6.933f, 7.454f,
+	 8.019f, 8.632f, 9.294f, 9.997f, 10.733f, 11.498f, 12.290f, 13.111f,
+	 13.962f, 14.843f, 15.756f, 16.701f, 17.680f, 18.690f, 19.730f,
+	 20.798f, 21.890f, 23.002f, 24.132f, 25.280f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f},
+	{10.291f, 8.741f, 7.210f, 5.758f, 4.427f, 3.243f, 2.218f, 1.353f,
+	 0.647f, 0.093f, -0.317f, -0.592f, -0.745f, -0.786f, -0.722f, -0.549f,
+	 -0.267f, 0.120f, 0.618f, 1.250f, 2.032f, 2.967f, 3.974f, 4.881f,
+	 5.562f, 5.935f, 6.006f, 5.839f, 5.491f, 5.006f, 4.446f, 3.908f,
+	 3.469f, 3.183f, 3.061f, 3.070f, 3.181f, 3.370f, 3.621f, 3.923f,
+	 4.268f, 4.647f, 5.055f, 5.486f, 5.936f, 6.400f, 6.883f, 7.399f,
+	 7.957f, 8.565f, 9.221f, 9.918f, 10.649f, 11.408f, 12.195f, 13.010f,
+	 13.857f, 14.735f, 15.644f, 16.587f, 17.565f, 18.575f, 19.616f,
+	 20.686f, 21.781f, 22.898f, 24.036f, 25.193f, 26.366f, 27.244f,
+	 27.244f, 27.244f, 27.244f, 27.244f, 27.244f, 27.244f, 27.244f,
+	 27.244f, 27.244f, 27.244f, 27.244f, 27.244f, 27.244f, 27.244f,
+	 27.244f, 27.244f, 27.244f, 27.244f, 27.244f, 27.244f, 27.244f},
+	{10.317f, 8.773f, 7.247f, 5.799f, 4.471f, 3.289f, 2.264f, 1.399f,
+	 0.692f, 0.138f, -0.273f, -0.550f, -0.704f, -0.747f, -0.684f, -0.511f,
+	 -0.230f, 0.157f, 0.654f, 1.287f, 2.069f, 3.004f, 4.012f, 4.920f,
+	 5.601f, 5.972f, 6.038f, 5.866f, 5.512f, 5.022f, 4.457f, 3.914f,
+	 3.471f, 3.182f, 3.058f, 3.065f, 3.175f, 3.361f, 3.609f, 3.907f,
+	 4.248f, 4.622f, 5.025f, 5.451f, 5.896f, 6.354f, 6.831f, 7.341f,
+	 7.894f, 8.495f, 9.145f, 9.835f, 10.561f, 11.315f, 12.095f, 12.905f,
+	 13.747f, 14.620f, 15.526f, 16.466f, 17.441f, 18.450f, 19.491f,
+	 20.562f, 21.660f, 22.781f, 23.924f, 25.089f, 26.273f, 27.470f,
+	 28.244f, 28.244f, 28.244f, 28.244f, 28.244f, 28.244f, 28.244f,
+	 28.244f, 28.244f, 28.244f, 28.244f, 28.244f, 28.244f, 28.244f,
+	 28.244f, 28.244f, 28.244f, 28.244f, 28.244f, 28.244f, 28.244f},
+	{10.342f, 8.804f, 7.283f, 5.839f, 4.514f, 3.334f, 2.310f, 1.445f,
+	 0.737f, 0.182f, -0.231f, -0.509f, -0.665f, -0.708f, -0.646f, -0.474f,
+	 -0.194f, 0.193f, 0.690f, 1.323f, 2.105f, 3.041f, 4.050f, 4.959f,
+	 5.638f, 6.007f, 6.069f, 5.892f, 5.533f, 5.038f, 4.467f, 3.920f,
+	 3.474f, 3.182f, 3.055f, 3.061f, 3.168f, 3.352f, 3.596f, 3.891f,
+	 4.227f, 4.597f, 4.995f, 5.415f, 5.854f, 6.307f, 6.778f, 7.282f,
+	 7.828f, 8.423f, 9.066f, 9.750f, 10.469f, 11.217f, 11.991f, 12.795f,
+	 13.632f, 14.500f, 15.401f, 16.337f, 17.310f, 18.317f, 19.357f,
+	 20.427f, 21.526f, 22.650f, 23.797f, 24.969f, 26.162f, 27.370f,
+	 28.594f, 29.244f, 29.244f, 29.244f, 29.244f, 29.244f, 29.244f,
+	 29.244f, 29.244f, 29.244f, 29.244f, 29.244f, 29.244f, 29.244f,
+	 29.244f, 29.244f, 29.244f, 29.244f, 29.244f, 29.244f, 29.244f},
+	{10.367f, 8.834f, 7.319f, 5.879f, 4.557f, 3.378f, 2.355f, 1.490f,
+	 0.782f, 0.225f, -0.188f, -0.468f, -0.625f, -0.670f, -0.609f, -0.438f,
+	 -0.158f, 0.229f, 0.726f, 1.358f, 2.141f, 3.078f, 4.088f, 4.997f,
+	 5.676f, 6.042f, 6.100f, 5.918f, 5.554f, 5.053f, 4.478f, 3.926f,
+	 3.476f, 3.181f, 3.052f, 3.056f, 3.161f, 3.342f, 3.583f, 3.874f,
+	 4.205f, 4.570f, 4.963f, 5.378f, 5.811f, 6.258f, 6.723f, 7.221f,
+	 7.761f, 8.349f, 8.985f, 9.663f, 10.375f, 11.115f, 11.883f, 12.681f,
+	 13.511f, 14.374f, 15.270f, 16.202f, 17.171f, 18.175f, 19.213f,
+	 20.283f, 21.382f, 22.507f, 23.657f, 24.833f, 26.033f, 27.252f,
+	 28.487f, 29.748f, 30.244f, 30.244f, 30.244f, 30.244f, 30.244f,
+	 30.244f, 30.244f, 30.244f, 30.244f, 30.244f, 30.244f, 30.244f,
+	 30.244f, 30.244f, 30.244f, 30.244f, 30.244f, 30.244f, 30.244f},
+	{10.392f, 8.864f, 7.354f, 5.918f, 4.599f, 3.421f, 2.399f, 1.534f,
+	 0.826f, 0.268f, -0.147f, -0.428f, -0.587f, -0.633f, -0.572f, -0.402f,
+	 -0.122f, 0.264f, 0.761f, 1.393f, 2.176f, 3.114f, 4.125f, 5.034f,
+	 5.712f, 6.076f, 6.131f, 5.944f, 5.575f, 5.069f, 4.489f, 3.932f,
+	 3.478f, 3.180f, 3.049f, 3.051f, 3.154f, 3.332f, 3.570f, 3.856f,
+	 4.183f, 4.543f, 4.931f, 5.340f, 5.767f, 6.208f, 6.667f, 7.158f,
+	 7.691f, 8.273f, 8.902f, 9.572f, 10.277f, 11.010f, 11.771f, 12.563f,
+	 13.387f, 14.243f, 15.133f, 16.060f, 17.024f, 18.024f, 19.059f,
+	 20.128f, 21.227f, 22.352f, 23.504f, 24.683f, 25.888f, 27.114f,
+	 28.361f, 29.634f, 30.936f, 31.244f, 31.244f, 31.244f, 31.244f,
+	 31.244f, 31.244f, 31.244f, 31.244f, 31.244f, 31.244f, 31.244f,
+	 31.244f, 31.244f, 31.244f, 31.244f, 31.244f, 31.244f, 31.244f},
+	{10.416f, 8.894f, 7.388f, 5.956f, 4.640f, 3.464f, 2.443f, 1.578f,
+	 0.869f, 0.310f, -0.106f, -0.389f, -0.549f, -0.596f, -0.536f, -0.366f,
+	 -0.087f, 0.299f, 0.796f, 1.428f, 2.211f, 3.149f, 4.161f, 5.071f,
+	 5.748f, 6.110f, 6.161f, 5.970f, 5.595f, 5.085f, 4.499f, 3.938f,
+	 3.480f, 3.180f, 3.047f, 3.046f, 3.147f, 3.322f, 3.556f, 3.839f,
+	 4.161f, 4.516f, 4.897f, 5.301f, 5.722f, 6.157f, 6.609f, 7.094f,
+	 7.620f, 8.195f, 8.816f, 9.479f, 10.176f, 10.903f, 11.656f, 12.440f,
+	 13.258f, 14.107f, 14.990f, 15.911f, 16.870f, 17.866f, 18.898f,
+	 19.963f, 21.060f, 22.185f, 23.338f, 24.519f, 25.728f, 26.960f,
+	 28.216f, 29.500f, 30.815f, 32.160f, 32.244f, 32.244f, 32.244f,
+	 32.244f, 32.244f, 32.244f, 32.244f, 32.244f, 32.244f, 32.244f,
+	 32.244f, 32.244f, 32.244f, 32.244f, 32.244f, 32.244f, 32.244f},
+	{10.439f, 8.923f, 7.422f, 5.994f, 4.680f, 3.507f, 2.486f, 1.621f,
+	 0.912f, 0.352f, -0.066f, -0.350f, -0.511f, -0.559f, -0.500f, -0.331f,
+	 -0.052f, 0.333f, 0.830f, 1.463f, 2.246f, 3.184f, 4.197f, 5.107f,
+	 5.783f, 6.143f, 6.190f, 5.995f, 5.616f, 5.100f, 4.510f, 3.944f,
+	 3.482f, 3.179f, 3.044f, 3.041f, 3.139f, 3.312f, 3.542f, 3.821f,
+	 4.138f, 4.488f, 4.863f, 5.261f, 5.676f, 6.104f, 6.550f, 7.028f,
+	 7.547f, 8.115f, 8.729f, 9.384f, 10.073f, 10.792f, 11.538f, 12.314f,
+	 13.124f, 13.966f, 14.843f, 15.757f, 16.711f, 17.702f, 18.729f,
+	 19.791f, 20.885f, 22.007f, 23.160f, 24.342f, 25.553f, 26.790f,
+	 28.053f, 29.347f, 30.673f, 32.032f, 33.244f, 33.244f, 33.244f,
+	 33.244f, 33.244f, 33.244f, 33.244f, 33.244f, 33.244f, 33.244f,
+	 33.244f, 33.244f, 33.244f, 33.244f, 33.244f, 33.244f, 33.244f},
+	{10.462f, 8.952f, 7.456f, 6.032f, 4.721f, 3.548f, 2.528f, 1.664f,
+	 0.954f, 0.393f, -0.026f, -0.312f, -0.474f, -0.523f, -0.465f, -0.297f,
+	 -0.018f, 0.367f, 0.864f, 1.497f, 2.280f, 3.219f, 4.232f, 5.142f,
+	 5.818f, 6.176f, 6.220f, 6.020f, 5.637f, 5.116f, 4.521f, 3.951f,
+	 3.485f, 3.178f, 3.041f, 3.036f, 3.132f, 3.301f, 3.528f, 3.802f,
+	 4.114f, 4.459f, 4.829f, 5.220f, 5.629f, 6.051f, 6.490f, 6.961f,
+	 7.473f, 8.033f, 8.639f, 9.286f, 9.968f, 10.678f, 11.416f, 12.185f,
+	 12.987f, 13.821f, 14.691f, 15.598f, 16.545f, 17.530f, 18.553f,
+	 19.610f, 20.700f, 21.820f, 22.970f, 24.153f, 25.366f, 26.605f,
+	 27.872f, 29.175f, 30.511f, 31.883f, 33.283f, 34.244f, 34.244f,
+	 34.244f, 34.244f, 34.244f, 34.244f, 34.244f, 34.244f, 34.244f,
+	 34.244f, 34.244f, 34.244f, 34.244f, 34.244f, 34.244f, 34.244f},
+	{10.485f, 8.980f, 7.489f, 6.069f, 4.760f, 3.590f, 2.571f, 1.706f,
+	 0.995f, 0.433f, 0.013f, -0.274f, -0.437f, -0.487f, -0.430f, -0.262f,
+	 0.016f, 0.401f, 0.898f, 1.530f, 2.314f, 3.253f, 4.267f, 5.177f,
+	 5.852f, 6.208f, 6.249f, 6.045f, 5.657f, 5.132f, 4.532f, 3.957f,
+	 3.487f, 3.177f, 3.037f, 3.031f, 3.124f, 3.291f, 3.514f, 3.783f,
+	 4.091f, 4.429f, 4.794f, 5.179f, 5.581f, 5.996f, 6.429f, 6.892f,
+	 7.397f, 7.949f, 8.547f, 9.186f, 9.859f, 10.562f, 11.292f, 12.052f,
+	 12.846f, 13.672f, 14.534f, 15.434f, 16.374f, 17.353f, 18.369f,
+	 19.422f, 20.507f, 21.623f, 22.770f, 23.951f, 25.164f, 26.406f,
+	 27.677f, 28.984f, 30.331f, 31.713f, 33.127f, 34.558f, 35.244f,
+	 35.244f, 35.244f, 35.244f, 35.244f, 35.244f, 35.244f, 35.244f,
+	 35.244f, 35.244f, 35.244f, 35.244f, 35.244f, 35.244f, 35.244f},
+	{10.507f, 9.008f, 7.522f, 6.105f, 4.799f, 3.631f, 2.612f, 1.748f,
+	 1.036f, 0.473f, 0.052f, -0.236f, -0.401f, -0.452f, -0.396f, -0.228f,
+	 0.050f, 0.435f, 0.931f, 1.564f, 2.348f, 3.287f, 4.301f, 5.211f,
+	 5.885f, 6.239f, 6.277f, 6.070f, 5.677f, 5.147f, 4.542f, 3.963f,
+	 3.489f, 3.177f, 3.034f, 3.026f, 3.116f, 3.280f, 3.499f, 3.764f,
+	 4.066f, 4.399f, 4.758f, 5.137f, 5.532f, 5.941f, 6.366f, 6.823f,
+	 7.320f, 7.864f, 8.454f, 9.085f, 9.749f, 10.443f, 11.164f, 11.916f,
+	 12.701f, 13.520f, 14.373f, 15.265f, 16.198f, 17.170f, 18.180f,
+	 19.226f, 20.307f, 21.418f, 22.561f, 23.739f, 24.950f, 26.193f,
+	 27.466f, 28.778f, 30.131f, 31.523f, 32.948f, 34.397f, 35.856f,
+	 36.244f, 36.244f, 36.244f, 36.244f, 36.244f, 36.244f, 36.244f,
+	 36.244f, 36.244f, 36.244f, 36.244f, 36.244f, 36.244f, 36.244f},
+	{10.529f, 9.035f, 7.554f, 6.141f, 4.838f, 3.671f, 2.653f, 1.789f,
+	 1.077f, 0.513f, 0.090f, -0.199f, -0.365f, -0.417f, -0.361f, -0.195f,
+	 0.083f, 0.468f, 0.965f, 1.597f, 2.381f, 3.321f, 4.335f, 5.245f,
+	 5.919f, 6.270f, 6.305f, 6.094f, 5.698f, 5.163f, 4.553f, 3.969f,
+	 3.491f, 3.176f, 3.031f, 3.020f, 3.108f, 3.269f, 3.484f, 3.744f,
+	 4.042f, 4.369f, 4.721f, 5.094f, 5.482f, 5.884f, 6.303f, 6.752f,
+	 7.242f, 7.778f, 8.359f, 8.981f, 9.637f, 10.322f, 11.034f, 11.777f,
+	 12.554f, 13.363f, 14.208f, 15.092f, 16.016f, 16.981f, 17.984f,
+	 19.024f, 20.098f, 21.204f, 22.342f, 23.516f, 24.725f, 25.967f,
+	 27.242f, 28.556f, 29.914f, 31.314f, 32.749f, 34.213f, 35.688f,
+	 37.170f, 37.244f, 37.244f, 37.244f, 37.244f, 37.244f, 37.244f,
+	 37.244f, 37.244f, 37.244f, 37.244f, 37.244f, 37.244f, 37.244f},
+	{10.550f, 9.063f, 7.586f, 6.177f, 4.876f, 3.711f, 2.694f, 1.830f,
+	 1.117f, 0.552f, 0.128f, -0.163f, -0.330f, -0.383f, -0.328f, -0.161f,
+	 0.116f, 0.501f, 0.998f, 1.630f, 2.414f, 3.354f, 4.369f, 5.279f,
+	 5.951f, 6.301f, 6.333f, 6.119f, 5.718f, 5.179f, 4.564f, 3.975f,
+	 3.494f, 3.175f, 3.028f, 3.015f, 3.100f, 3.258f, 3.469f, 3.724f,
+	 4.016f, 4.338f, 4.684f, 5.050f, 5.432f, 5.827f, 6.239f, 6.680f,
+	 7.162f, 7.690f, 8.263f, 8.876f, 9.523f, 10.199f, 10.902f, 11.636f,
+	 12.403f, 13.204f, 14.039f, 14.914f, 15.830f, 16.786f, 17.782f,
+	 18.815f, 19.882f, 20.982f, 22.115f, 23.284f, 24.490f, 25.729f,
+	 27.004f, 28.320f, 29.680f, 31.086f, 32.530f, 34.004f, 35.496f,
+	 36.995f, 38.244f, 38.244f, 38.244f, 38.244f, 38.244f, 38.244f,
+	 38.244f, 38.244f, 38.244f, 38.244f, 38.244f, 38.244f, 38.244f},
+	{10.571f, 9.089f, 7.617f, 6.212f, 4.914f, 3.750f, 2.734f, 1.870f,
+	 1.157f, 0.591f, 0.166f, -0.126f, -0.295f, -0.349f, -0.294f, -0.128f,
+	 0.149f, 0.533f, 1.030f, 1.663f, 2.447f, 3.387f, 4.402f, 5.312f,
+	 5.983f, 6.332f, 6.361f, 6.143f, 5.738f, 5.194f, 4.575f, 3.982f,
+	 3.496f, 3.174f, 3.025f, 3.009f, 3.092f, 3.246f, 3.453f, 3.704f,
+	 3.991f, 4.307f, 4.647f, 5.006f, 5.381f, 5.769f, 6.173f, 6.608f,
+	 7.082f, 7.601f, 8.165f, 8.769f, 9.407f, 10.073f, 10.767f, 11.492f,
+	 12.250f, 13.041f, 13.867f, 14.732f, 15.639f, 16.587f, 17.575f,
+	 18.600f, 19.660f, 20.752f, 21.879f, 23.043f, 24.244f, 25.480f,
+	 26.753f, 28.069f, 29.432f, 30.841f, 32.293f, 33.775f, 35.281f,
+	 36.795f, 38.319f, 39.244f, 39.244f, 39.244f, 39.244f, 39.244f,
+	 39.244f, 39.244f, 39.244f, 39.244f, 39.244f, 39.244f, 39.244f},
+	{10.592f, 9.116f, 7.649f, 6.247f, 4.952f, 3.789f, 2.774f, 1.910f,
+	 1.196f, 0.630f, 0.203f, -0.090f, -0.260f, -0.315f, -0.261f, -0.096f,
+	 0.181f, 0.566f, 1.063f, 1.696f, 2.480f, 3.420f, 4.435f, 5.344f,
+	 6.015f, 6.362f, 6.388f, 6.167f, 5.758f, 5.210f, 4.586f, 3.988f,
+	 3.498f, 3.173f, 3.021f, 3.004f, 3.084f, 3.235f, 3.438f, 3.684f,
+	 3.965f, 4.275f, 4.609f, 4.961f, 5.330f, 5.710f, 6.107f, 6.534f,
+	 7.000f, 7.511f, 8.066f, 8.661f, 9.289f, 9.946f, 10.631f, 11.346f,
+	 12.094f, 12.875f, 13.691f, 14.547f, 15.445f, 16.384f, 17.363f,
+	 18.380f, 19.432f, 20.516f, 21.635f, 22.792f, 23.988f, 25.221f,
+	 26.490f, 27.805f, 29.169f, 30.581f, 32.037f, 33.527f, 35.042f,
+	 36.571f, 38.112f, 39.662f, 40.244f, 40.244f, 40.244f, 40.244f,
+	 40.244f, 40.244f, 40.244f, 40.244f, 40.244f, 40.244f, 40.244f},
+	{10.613f, 9.142f, 7.679f, 6.281f, 4.989f, 3.828f, 2.814f, 1.949f,
+	 1.235f, 0.668f, 0.240f, -0.055f, -0.226f, -0.281f, -0.228f, -0.063f,
+	 0.214f, 0.598f, 1.095f, 1.728f, 2.512f, 3.453f, 4.467f, 5.377f,
+	 6.047f, 6.391f, 6.415f, 6.191f, 5.778f, 5.225f, 4.596f, 3.994f,
+	 3.501f, 3.172f, 3.018f, 2.998f, 3.076f, 3.223f, 3.422f, 3.663f,
+	 3.939f, 4.243f, 4.570f, 4.916f, 5.277f, 5.651f, 6.041f, 6.459f,
+	 6.917f, 7.419f, 7.966f, 8.551f, 9.170f, 9.817f, 10.492f, 11.197f,
+	 11.935f, 12.706f, 13.513f, 14.359f, 15.247f, 16.177f, 17.147f,
+	 18.155f, 19.198f, 20.274f, 21.385f, 22.534f, 23.723f, 24.951f,
+	 26.217f, 27.529f, 28.892f, 30.305f, 31.763f, 33.261f, 34.783f,
+	 36.325f, 37.879f, 39.450f, 41.033f, 41.244f, 41.244f, 41.244f,
+	 41.244f, 41.244f, 41.244f, 41.244f, 41.244f, 41.244f, 41.244f},
+	{10.633f, 9.168f, 7.710f, 6.316f, 5.026f, 3.867f, 2.853f, 1.989f,
+	 1.274f, 0.705f, 0.277f, -0.020f, -0.191f, -0.248f, -0.196f, -0.031f,
+	 0.246f, 0.630f, 1.127f, 1.760f, 2.545f, 3.485f, 4.499f, 5.408f,
+	 6.078f, 6.421f, 6.442f, 6.214f, 5.798f, 5.241f, 4.607f, 4.001f,
+	 3.503f, 3.172f, 3.015f, 2.992f, 3.067f, 3.211f, 3.406f, 3.642f,
+	 3.913f, 4.211f, 4.531f, 4.870f, 5.224f, 5.591f, 5.973f, 6.384f,
+	 6.833f, 7.327f, 7.864f, 8.440f, 9.049f, 9.686f, 10.351f, 11.047f,
+	 11.774f, 12.535f, 13.331f, 14.167f, 15.045f, 15.965f, 16.925f,
+	 17.924f, 18.958f, 20.025f, 21.127f, 22.269f, 23.451f, 24.671f,
+	 25.933f, 27.243f, 28.602f, 30.014f, 31.475f, 32.974f, 34.505f,
+	 36.056f, 37.624f, 39.212f, 40.813f, 42.244f, 42.244f, 42.244f,
+	 42.244f, 42.244f, 42.244f, 42.244f, 42.244f, 42.244f, 42.244f},
+	{10.653f, 9.193f, 7.740f, 6.349f, 5.062f, 3.905f, 2.891f, 2.027f,
+	 1.312f, 0.743f, 0.313f, 0.015f, -0.158f, -0.215f, -0.164f, 0.001f,
+	 0.277f, 0.662f, 1.159f, 1.792f, 2.576f, 3.517f, 4.531f, 5.440f,
+	 6.108f, 6.450f, 6.469f, 6.238f, 5.817f, 5.256f, 4.618f, 4.007f,
+	 3.505f, 3.171f, 3.012f, 2.987f, 3.059f, 3.199f, 3.390f, 3.621f,
+	 3.886f, 4.178f, 4.492f, 4.824f, 5.171f, 5.530f, 5.905f, 6.308f,
+	 6.749f, 7.233f, 7.761f, 8.327f, 8.927f, 9.554f, 10.209f, 10.894f,
+	 11.611f, 12.362f, 13.147f, 13.972f, 14.839f, 15.749f, 16.700f,
+	 17.689f, 18.713f, 19.770f, 20.863f, 21.996f, 23.170f, 24.384f,
+	 25.639f, 26.944f, 28.301f, 29.710f, 31.171f, 32.672f, 34.208f,
+	 35.766f, 37.346f, 38.946f, 40.567f, 42.203f, 43.244f, 43.244f,
+	 43.244f, 43.244f, 43.244f, 43.244f, 43.244f, 43.244f, 43.244f},
+	{10.672f, 9.219f, 7.770f, 6.383f, 5.098f, 3.942f, 2.930f, 2.066f,
+	 1.350f, 0.780f, 0.349f, 0.050f, -0.124f, -0.183f, -0.132f, 0.033f,
+	 0.309f, 0.693f, 1.190f, 1.824f, 2.608f, 3.549f, 4.563f, 5.471f,
+	 6.139f, 6.478f, 6.495f, 6.261f, 5.837f, 5.272f, 4.629f, 4.013f,
+	 3.508f, 3.170f, 3.008f, 2.981f, 3.050f, 3.187f, 3.374f, 3.600f,
+	 3.859f, 4.145f, 4.452f, 4.777f, 5.117f, 5.469f, 5.836f, 6.231f,
+	 6.663f, 7.139f, 7.657f, 8.214f, 8.803f, 9.420f, 10.065f, 10.739f,
+	 11.446f, 12.186f, 12.960f, 13.774f, 14.631f, 15.531f, 16.471f,
+	 17.450f, 18.464f, 19.511f, 20.593f, 21.717f, 22.882f, 24.088f,
+	 25.337f, 26.635f, 27.987f, 29.395f, 30.852f, 32.355f, 33.893f,
+	 35.457f, 37.045f, 38.657f, 40.295f, 41.947f, 43.616f, 44.244f,
+	 44.244f, 44.244f, 44.244f, 44.244f, 44.244f, 44.244f, 44.244f},
+	{10.692f, 9.244f, 7.800f, 6.416f, 5.134f, 3.980f, 2.968f, 2.104f,
+	 1.388f, 0.817f, 0.384f, 0.084f, -0.091f, -0.151f, -0.100f, 0.064f,
+	 0.340f, 0.725f, 1.222f, 1.855f, 2.640f, 3.580f, 4.594f, 5.502f,
+	 6.169f, 6.507f, 6.521f, 6.284f, 5.857f, 5.287f, 4.640f, 4.020f,
+	 3.510f, 3.169f, 3.005f, 2.975f, 3.042f, 3.175f, 3.357f, 3.579f,
+	 3.832f, 4.112f, 4.412f, 4.730f, 5.063f, 5.407f, 5.766f, 6.153f,
+	 6.577f, 7.044f, 7.552f, 8.099f, 8.678f, 9.285f, 9.919f, 10.583f,
+	 11.279f, 12.008f, 12.771f, 13.574f, 14.420f, 15.309f, 16.239f,
+	 17.207f, 18.210f, 19.246f, 20.318f, 21.431f, 22.587f, 23.784f,
+	 25.026f, 26.318f, 27.664f, 29.066f, 30.521f, 32.023f, 33.562f,
+	 35.130f, 36.724f, 38.347f, 39.996f, 41.666f, 43.357f, 45.066f,
+	 45.244f, 45.244f, 45.244f, 45.244f, 45.244f, 45.244f, 45.244f},
+	{10.711f, 9.269f, 7.830f, 6.450f, 5.170f, 4.017f, 3.006f, 2.142f,
+	 1.426f, 0.853f, 0.419f, 0.118f, -0.058f, -0.118f, -0.068f, 0.095f,
+	 0.371f, 0.756f, 1.253f, 1.887f, 2.671f, 3.612f, 4.626f, 5.533f,
+	 6.198f, 6.535f, 6.547f, 6.307f, 5.876f, 5.303f, 4.651f, 4.026f,
+	 3.512f, 3.168f, 3.001f, 2.969f, 3.033f, 3.163f, 3.340f, 3.557f,
+	 3.805f, 4.078f, 4.372f, 4.683f, 5.008f, 5.344f, 5.696f, 6.075f,
+	 6.490f, 6.947f, 7.447f, 7.983f, 8.552f, 9.149f, 9.772f, 10.426f,
+	 11.110f, 11.828f, 12.579f, 13.371f, 14.206f, 15.084f, 16.002f,
+	 16.960f, 17.952f, 18.977f, 20.038f, 21.140f, 22.286f, 23.474f,
+	 24.706f, 25.991f, 27.331f, 28.727f, 30.178f, 31.676f, 33.216f,
+	 34.785f, 36.384f, 38.014f, 39.674f, 41.359f, 43.068f, 44.799f,
+	 46.244f, 46.244f, 46.244f, 46.244f, 46.244f, 46.244f, 46.244f},
+	{10.730f, 9.293f, 7.859f, 6.482f, 5.205f, 4.054f, 3.044f, 2.180f,
+	 1.463f, 0.889f, 0.455f, 0.152f, -0.025f, -0.087f, -0.037f, 0.126f,
+	 0.402f, 0.787f, 1.284f, 1.918f, 2.703f, 3.643f, 4.656f, 5.563f,
+	 6.228f, 6.563f, 6.573f, 6.330f, 5.896f, 5.318f, 4.662f, 4.032f,
+	 3.515f, 3.167f, 2.998f, 2.963f, 3.024f, 3.150f, 3.324f, 3.535f,
+	 3.777f, 4.044f, 4.331f, 4.635f, 4.953f, 5.281f, 5.625f, 5.996f,
+	 6.402f, 6.851f, 7.340f, 7.866f, 8.425f, 9.011f, 9.624f, 10.266f,
+	 10.940f, 11.646f, 12.386f, 13.166f, 13.989f, 14.856f, 15.763f,
+	 16.709f, 17.690f, 18.704f, 19.753f, 20.844f, 21.978f, 23.157f,
+	 24.380f, 25.656f, 26.988f, 28.378f, 29.823f, 31.318f, 32.854f,
+	 34.424f, 36.026f, 37.661f, 39.331f, 41.027f, 42.750f, 44.503f,
+	 46.281f, 47.244f, 47.244f, 47.244f, 47.244f, 47.244f, 47.244f},
+	{10.749f, 9.318f, 7.888f, 6.515f, 5.240f, 4.091f, 3.081f, 2.217f,
+	 1.500f, 0.925f, 0.489f, 0.186f, 0.007f, -0.055f, -0.006f, 0.157f,
+	 0.433f, 0.818f, 1.315f, 1.949f, 2.734f, 3.674f, 4.687f, 5.593f,
+	 6.257f, 6.591f, 6.599f, 6.353f, 5.915f, 5.334f, 4.673f, 4.039f,
+	 3.517f, 3.166f, 2.994f, 2.957f, 3.015f, 3.138f, 3.307f, 3.513f,
+	 3.749f, 4.010f, 4.290f, 4.587f, 4.897f, 5.218f, 5.554f, 5.916f,
+	 6.314f, 6.753f, 7.233f, 7.749f, 8.297f, 8.872f, 9.474f, 10.106f,
+	 10.768f, 11.462f, 12.191f, 12.959f, 13.770f, 14.625f, 15.521f,
+	 16.456f, 17.425f, 18.426f, 19.463f, 20.542f, 21.666f, 22.833f,
+	 24.047f, 25.313f, 26.637f, 28.019f, 29.457f, 30.946f, 32.480f,
+	 34.048f, 35.651f, 37.291f, 38.965f, 40.671f, 42.408f, 44.178f,
+	 45.976f, 47.795f, 48.244f, 48.244f, 48.244f, 48.244f, 48.244f},
+	{10.767f, 9.342f, 7.917f, 6.547f, 5.275f, 4.127f, 3.118f, 2.254f,
+	 1.536f, 0.961f, 0.524f, 0.219f, 0.039f, -0.023f, 0.025f, 0.188f,
+	 0.464f, 0.848f, 1.346f, 1.980f, 2.765f, 3.704f, 4.718f, 5.623f,
+	 6.286f, 6.618f, 6.624f, 6.376f, 5.935f, 5.349f, 4.684f, 4.045f,
+	 3.519f, 3.165f, 2.991f, 2.951f, 3.006f, 3.125f, 3.290f, 3.491f,
+	 3.721f, 3.976f, 4.249f, 4.538f, 4.841f, 5.154f, 5.482f, 5.836f,
+	 6.225f, 6.655f, 7.124f, 7.630f, 8.168f, 8.732f, 9.323f, 9.943f,
+	 10.594f, 11.277f, 11.993f, 12.750f, 13.549f, 14.392f, 15.277f,
+	 16.199f, 17.156f, 18.145f, 19.170f, 20.236f, 21.348f, 22.504f,
+	 23.707f, 24.963f, 26.278f, 27.651f, 29.082f, 30.564f, 32.093f,
+	 33.658f, 35.261f, 36.901f, 38.580f, 40.294f, 42.041f, 43.825f,
+	 45.642f, 47.486f, 49.244f, 49.244f, 49.244f, 49.244f, 49.244f},
+	{10.785f, 9.366f, 7.946f, 6.580f, 5.310f, 4.163f, 3.155f, 2.291f,
+	 1.573f, 0.997f, 0.558f, 0.252f, 0.072f, 0.008f, 0.056f, 0.218f,
+	 0.494f, 0.879f, 1.377f, 2.011f, 2.795f, 3.735f, 4.748f, 5.653f,
+	 6.315f, 6.645f, 6.649f, 6.399f, 5.954f, 5.365f, 4.695f, 4.052f,
+	 3.522f, 3.165f, 2.987f, 2.945f, 2.998f, 3.113f, 3.273f, 3.469f,
+	 3.693f, 3.941f, 4.207f, 4.489f, 4.784f, 5.090f, 5.410f, 5.756f,
+	 6.136f, 6.556f, 7.015f, 7.511f, 8.037f, 8.591f, 9.171f, 9.780f,
+	 10.420f, 11.090f, 11.795f, 12.539f, 13.326f, 14.157f, 15.029f,
+	 15.939f, 16.884f, 17.860f, 18.872f, 19.926f, 21.025f, 22.169f,
+	 23.361f, 24.607f, 25.911f, 27.275f, 28.696f, 30.172f, 31.693f,
+	 33.255f, 34.855f, 36.496f, 38.177f, 39.895f, 41.651f, 43.447f,
+	 45.281f, 47.145f, 49.034f, 50.244f, 50.244f, 50.244f, 50.244f},
+	{10.804f, 9.390f, 7.974f, 6.612f, 5.344f, 4.199f, 3.192f, 2.328f,
+	 1.609f, 1.032f, 0.593f, 0.285f, 0.103f, 0.039f, 0.087f, 0.249f,
+	 0.524f, 0.909f, 1.407f, 2.041f, 2.826f, 3.766f, 4.778f, 5.682f,
+	 6.343f, 6.672f, 6.675f, 6.421f, 5.974f, 5.380f, 4.706f, 4.058f,
+	 3.524f, 3.164f, 2.984f, 2.939f, 2.989f, 3.100f, 3.256f, 3.446f,
+	 3.665f, 3.906f, 4.165f, 4.440f, 4.728f, 5.025f, 5.337f, 5.675f,
+	 6.046f, 6.456f, 6.906f, 7.391f, 7.906f, 8.449f, 9.018f, 9.616f,
+	 10.243f, 10.902f, 11.594f, 12.326f, 13.101f, 13.919f, 14.779f,
+	 15.677f, 16.609f, 17.572f, 18.571f, 19.611f, 20.698f, 21.830f,
+	 23.010f, 24.245f, 25.538f, 26.891f, 28.303f, 29.769f, 31.284f,
+	 32.839f, 34.436f, 36.075f, 37.756f, 39.478f, 41.240f, 43.045f,
+	 44.891f, 46.773f, 48.685f, 50.621f, 51.244f, 51.244f, 51.244f},
+	{10.822f, 9.414f, 8.002f, 6.643f, 5.378f, 4.235f, 3.228f, 2.365f,
+	 1.645f, 1.067f, 0.626f, 0.318f, 0.135f, 0.070f, 0.117f, 0.279f,
+	 0.555f, 0.940f, 1.438f, 2.072f, 2.857f, 3.796f, 4.808f, 5.712f,
+	 6.371f, 6.699f, 6.700f, 6.444f, 5.993f, 5.395f, 4.717f, 4.065f,
+	 3.527f, 3.163f, 2.980f, 2.933f, 2.979f, 3.087f, 3.238f, 3.424f,
+	 3.636f, 3.871f, 4.123f, 4.391f, 4.670f, 4.960f, 5.264f, 5.593f,
+	 5.955f, 6.356f, 6.795f, 7.270f, 7.775f, 8.307f, 8.864f, 9.450f,
+	 10.066f, 10.712f, 11.392f, 12.111f, 12.873f, 13.680f, 14.527f,
+	 15.413f, 16.332f, 17.282f, 18.266f, 19.294f, 20.366f, 21.486f,
+	 22.653f, 23.876f, 25.158f, 26.500f, 27.901f, 29.358f, 30.864f,
+	 32.413f, 34.004f, 35.639f, 37.320f, 39.042f, 40.807f, 42.619f,
+	 44.477f, 46.374f, 48.306f, 50.268f, 52.244f, 52.244f, 52.244f},
+	{10.839f, 9.438f, 8.031f, 6.675f, 5.412f, 4.270f, 3.264f, 2.401f,
+	 1.681f, 1.102f, 0.660f, 0.351f, 0.167f, 0.101f, 0.147f, 0.309f,
+	 0.585f, 0.970f, 1.468f, 2.103f, 2.887f, 3.826f, 4.838f, 5.741f,
+	 6.399f, 6.726f, 6.724f, 6.466f, 6.012f, 5.411f, 4.727f, 4.071f,
+	 3.529f, 3.162f, 2.977f, 2.927f, 2.970f, 3.075f, 3.221f, 3.401f,
+	 3.608f, 3.836f, 4.081f, 4.341f, 4.613f, 4.895f, 5.191f, 5.511f,
+	 5.864f, 6.255f, 6.685f, 7.148f, 7.642f, 8.163f, 8.709f, 9.284f,
+	 9.887f, 10.522f, 11.189f, 11.895f, 12.645f, 13.438f, 14.273f, 15.146f,
+	 16.052f, 16.988f, 17.959f, 18.972f, 20.031f, 21.137f, 22.292f,
+	 23.503f, 24.772f, 26.102f, 27.492f, 28.938f, 30.435f, 31.975f,
+	 33.560f, 35.191f, 36.868f, 38.590f, 40.357f, 42.174f, 44.039f,
+	 45.948f, 47.896f, 49.878f, 51.886f, 53.244f, 53.244f},
+	{10.857f, 9.461f, 8.059f, 6.706f, 5.446f, 4.306f, 3.301f, 2.437f,
+	 1.717f, 1.137f, 0.694f, 0.383f, 0.198f, 0.131f, 0.177f, 0.339f,
+	 0.615f, 1.000f, 1.499f, 2.133f, 2.917f, 3.856f, 4.867f, 5.769f,
+	 6.427f, 6.753f, 6.749f, 6.489f, 6.032f, 5.426f, 4.738f, 4.078f,
+	 3.531f, 3.161f, 2.973f, 2.921f, 2.961f, 3.062f, 3.204f, 3.378f,
+	 3.579f, 3.800f, 4.039f, 4.291f, 4.555f, 4.829f, 5.117f, 5.429f,
+	 5.773f, 6.154f, 6.573f, 7.026f, 7.509f, 8.019f, 8.553f, 9.116f,
+	 9.708f, 10.330f, 10.984f, 11.678f, 12.414f, 13.195f, 14.017f, 14.877f,
+	 15.769f, 16.691f, 17.648f, 18.647f, 19.692f, 20.785f, 21.927f,
+	 23.124f, 24.381f, 25.698f, 27.076f, 28.510f, 29.996f, 31.528f,
+	 33.105f, 34.730f, 36.403f, 38.122f, 39.889f, 41.708f, 43.579f,
+	 45.497f, 47.459f, 49.459f, 51.491f, 53.543f, 54.244f},
+	{10.875f, 9.484f, 8.086f, 6.738f, 5.480f, 4.341f, 3.336f, 2.473f,
+	 1.752f, 1.172f, 0.727f, 0.415f, 0.229f, 0.162f, 0.207f, 0.369f,
+	 0.644f, 1.030f, 1.529f, 2.163f, 2.948f, 3.886f, 4.897f, 5.798f,
+	 6.455f, 6.779f, 6.774f, 6.511f, 6.051f, 5.442f, 4.749f, 4.084f,
+	 3.534f, 3.160f, 2.970f, 2.915f, 2.952f, 3.049f, 3.186f, 3.355f,
+	 3.550f, 3.765f, 3.996f, 4.241f, 4.497f, 4.764f, 5.043f, 5.346f,
+	 5.681f, 6.053f, 6.461f, 6.903f, 7.375f, 7.873f, 8.397f, 8.948f,
+	 9.527f, 10.137f, 10.778f, 11.459f, 12.183f, 12.950f, 13.760f, 14.606f,
+	 15.485f, 16.393f, 17.335f, 18.319f, 19.350f, 20.429f, 21.557f,
+	 22.741f, 23.985f, 25.289f, 26.653f, 28.076f, 29.550f, 31.072f,
+	 32.640f, 34.258f, 35.925f, 37.639f, 39.404f, 41.224f, 43.098f,
+	 45.023f, 46.995f, 49.011f, 51.064f, 53.142f, 55.244f},
+	{10.892f, 9.507f, 8.114f, 6.769f, 5.514f, 4.376f, 3.372f, 2.509f,
+	 1.788f, 1.206f, 0.761f, 0.447f, 0.260f, 0.192f, 0.237f, 0.398f,
+	 0.674f, 1.060f, 1.559f, 2.193f, 2.978f, 3.916f, 4.926f, 5.827f,
+	 6.482f, 6.805f, 6.798f, 6.533f, 6.070f, 5.457f, 4.760f, 4.090f,
+	 3.536f, 3.159f, 2.966f, 2.909f, 2.943f, 3.036f, 3.168f, 3.332f,
+	 3.521f, 3.729f, 3.953f, 4.190f, 4.439f, 4.697f, 4.969f, 5.263f,
+	 5.589f, 5.951f, 6.349f, 6.780f, 7.241f, 7.728f, 8.239f, 8.778f,
+	 9.346f, 9.943f, 10.571f, 11.239f, 11.949f, 12.704f, 13.500f, 14.333f,
+	 15.198f, 16.092f, 17.019f, 17.989f, 19.005f, 20.069f, 21.184f,
+	 22.354f, 23.584f, 24.874f, 26.225f, 27.634f, 29.097f, 30.607f,
+	 32.166f, 33.775f, 35.435f, 37.144f, 38.904f, 40.722f, 42.598f,
+	 44.527f, 46.507f, 48.536f, 50.605f, 52.705f, 54.834f},
+	{10.909f, 9.530f, 8.142f, 6.800f, 5.547f, 4.411f, 3.408f, 2.545f,
+	 1.823f, 1.241f, 0.794f, 0.479f, 0.291f, 0.222f, 0.267f, 0.428f,
+	 0.704f, 1.089f, 1.589f, 2.223f, 3.008f, 3.946f, 4.955f, 5.855f,
+	 6.510f, 6.831f, 6.823f, 6.555f, 6.089f, 5.473f, 4.771f, 4.097f,
+	 3.539f, 3.158f, 2.963f, 2.902f, 2.934f, 3.023f, 3.151f, 3.309f,
+	 3.492f, 3.693f, 3.910f, 4.140f, 4.381f, 4.631f, 4.894f, 5.180f,
+	 5.496f, 5.848f, 6.236f, 6.656f, 7.106f, 7.581f, 8.081f, 8.608f,
+	 9.164f, 9.748f, 10.363f, 11.018f, 11.715f, 12.456f, 13.239f, 14.059f,
+	 14.909f, 15.789f, 16.701f, 17.656f, 18.657f, 19.706f, 20.807f,
+	 21.963f, 23.179f, 24.455f, 25.791f, 27.187f, 28.636f, 30.135f,
+	 31.682f, 33.282f, 34.933f, 36.635f, 38.391f, 40.206f, 42.080f,
+	 44.011f, 45.997f, 48.035f, 50.119f, 52.238f, 54.392f},
+	{10.927f, 9.553f, 8.169f, 6.831f, 5.580f, 4.446f, 3.443f, 2.580f,
+	 1.858f, 1.275f, 0.827f, 0.511f, 0.322f, 0.252f, 0.297f, 0.457f,
+	 0.733f, 1.119f, 1.619f, 2.253f, 3.038f, 3.975f, 4.984f, 5.883f,
+	 6.537f, 6.857f, 6.847f, 6.577f, 6.108f, 5.488f, 4.782f, 4.103f,
+	 3.541f, 3.157f, 2.959f, 2.896f, 2.924f, 3.010f, 3.133f, 3.286f,
+	 3.462f, 3.657f, 3.867f, 4.089f, 4.322f, 4.564f, 4.819f, 5.096f,
+	 5.403f, 5.745f, 6.123f, 6.532f, 6.970f, 7.434f, 7.922f, 8.437f,
+	 8.980f, 9.552f, 10.155f, 10.796f, 11.479f, 12.207f, 12.977f, 13.782f,
+	 14.619f, 15.484f, 16.381f, 17.320f, 18.306f, 19.341f, 20.426f,
+	 21.568f, 22.769f, 24.030f, 25.352f, 26.733f, 28.170f, 29.655f,
+	 31.192f, 32.780f, 34.422f, 36.116f, 37.864f, 39.673f, 41.545f,
+	 43.477f, 45.466f, 47.510f, 49.604f, 51.739f, 53.914f},
+	{10.944f, 9.576f, 8.197f, 6.861f, 5.613f, 4.480f, 3.479f, 2.616f,
+	 1.893f, 1.309f, 0.860f, 0.543f, 0.353f, 0.282f, 0.326f, 0.487f,
+	 0.763f, 1.149f, 1.648f, 2.283f, 3.067f, 4.005f, 5.013f, 5.911f,
+	 6.564f, 6.883f, 6.871f, 6.599f, 6.127f, 5.503f, 4.793f, 4.110f,
+	 3.543f, 3.156f, 2.955f, 2.890f, 2.915f, 2.996f, 3.115f, 3.263f,
+	 3.433f, 3.621f, 3.823f, 4.038f, 4.263f, 4.497f, 4.744f, 5.012f,
+	 5.310f, 5.642f, 6.009f, 6.407f, 6.834f, 7.286f, 7.763f, 8.266f,
+	 8.797f, 9.355f, 9.945f, 10.572f, 11.243f, 11.957f, 12.713f, 13.505f,
+	 14.327f, 15.177f, 16.059f, 16.982f, 17.953f, 18.972f, 20.043f,
+	 21.170f, 22.356f, 23.602f, 24.909f, 26.275f, 27.697f, 29.170f,
+	 30.693f, 32.270f, 33.901f, 35.585f, 37.326f, 39.128f, 40.995f,
+	 42.924f, 44.914f, 46.963f, 49.066f, 51.214f, 53.406f},
+	{10.961f, 9.599f, 8.224f, 6.892f, 5.646f, 4.515f, 3.514f, 2.651f,
+	 1.928f, 1.343f, 0.893f, 0.574f, 0.383f, 0.312f, 0.356f, 0.516f,
+	 0.792f, 1.178f, 1.678f, 2.313f, 3.097f, 4.034f, 5.042f, 5.939f,
+	 6.591f, 6.909f, 6.895f, 6.621f, 6.147f, 5.519f, 4.804f, 4.117f,
+	 3.546f, 3.155f, 2.952f, 2.884f, 2.906f, 2.983f, 3.097f, 3.239f,
+	 3.403f, 3.585f, 3.780f, 3.987f, 4.204f, 4.430f, 4.668f, 4.928f,
+	 5.216f, 5.538f, 5.895f, 6.282f, 6.698f, 7.138f, 7.603f, 8.094f,
+	 8.612f, 9.158f, 9.734f, 10.348f, 11.005f, 11.706f, 12.448f, 13.226f,
+	 14.034f, 14.868f, 15.735f, 16.643f, 17.597f, 18.601f, 19.657f,
+	 20.769f, 21.939f, 23.170f, 24.461f, 25.812f, 27.219f, 28.677f,
+	 30.188f, 31.752f, 33.372f, 35.045f, 36.776f, 38.570f, 40.431f,
+	 42.357f, 44.345f, 46.396f, 48.504f, 50.661f, 52.868f},
+	{10.978f, 9.622f, 8.251f, 6.923f, 5.679f, 4.549f, 3.549f, 2.686f,
+	 1.962f, 1.376f, 0.925f, 0.606f, 0.414f, 0.342f, 0.385f, 0.545f,
+	 0.821f, 1.208f, 1.708f, 2.343f, 3.127f, 4.063f, 5.070f, 5.967f,
+	 6.618f, 6.934f, 6.919f, 6.643f, 6.166f, 5.534f, 4.815f, 4.123f,
+	 3.548f, 3.154f, 2.948f, 2.877f, 2.896f, 2.970f, 3.079f, 3.216f,
+	 3.374f, 3.548f, 3.736f, 3.936f, 4.145f, 4.363f, 4.592f, 4.843f,
+	 5.122f, 5.435f, 5.780f, 6.156f, 6.561f, 6.990f, 7.442f, 7.921f,
+	 8.427f, 8.959f, 9.522f, 10.123f, 10.766f, 11.453f, 12.182f, 12.946f,
+	 13.739f, 14.558f, 15.409f, 16.301f, 17.240f, 18.228f, 19.268f,
+	 20.365f, 21.520f, 22.734f, 24.009f, 25.344f, 26.735f, 28.179f,
+	 29.676f, 31.227f, 32.834f, 34.496f, 36.216f, 38.001f, 39.854f,
+	 41.774f, 43.759f, 45.809f, 47.921f, 50.085f, 52.304f},
+	{10.994f, 9.644f, 8.278f, 6.953f, 5.712f, 4.583f, 3.584f, 2.721f,
+	 1.997f, 1.410f, 0.958f, 0.637f, 0.444f, 0.371f, 0.414f, 0.574f,
+	 0.850f, 1.237f, 1.737f, 2.373f, 3.157f, 4.093f, 5.099f, 5.995f,
+	 6.644f, 6.960f, 6.943f, 6.665f, 6.185f, 5.550f, 4.826f, 4.130f,
+	 3.551f, 3.153f, 2.944f, 2.871f, 2.887f, 2.957f, 3.061f, 3.192f,
+	 3.344f, 3.512f, 3.692f, 3.884f, 4.085f, 4.295f, 4.516f, 4.758f,
+	 5.028f, 5.330f, 5.665f, 6.030f, 6.423f, 6.840f, 7.281f, 7.748f,
+	 8.241f, 8.760f, 9.310f, 9.897f, 10.526f, 11.200f, 11.915f, 12.664f,
+	 13.443f, 14.247f, 15.082f, 15.957f, 16.880f, 17.853f, 18.877f,
+	 19.958f, 21.097f, 22.295f, 23.554f, 24.872f, 26.248f, 27.676f,
+	 29.158f, 30.696f, 32.290f, 33.938f, 35.646f, 37.421f, 39.265f,
+	 41.178f, 43.158f, 45.206f, 47.318f, 49.486f, 51.712f},
+	{11.011f, 9.667f, 8.305f, 6.983f, 5.745f, 4.617f, 3.619f, 2.756f,
+	 2.031f, 1.444f, 0.990f, 0.669f, 0.474f, 0.401f, 0.443f, 0.603f,
+	 0.879f, 1.266f, 1.767f, 2.402f, 3.186f, 4.122f, 5.127f, 6.022f,
+	 6.671f, 6.985f, 6.967f, 6.687f, 6.204f, 5.565f, 4.837f, 4.136f,
+	 3.553f, 3.152f, 2.941f, 2.865f, 2.877f, 2.943f, 3.043f, 3.169f,
+	 3.314f, 3.475f, 3.648f, 3.833f, 4.026f, 4.227f, 4.440f, 4.673f,
+	 4.934f, 5.226f, 5.550f, 5.904f, 6.285f, 6.691f, 7.120f, 7.574f,
+	 8.054f, 8.561f, 9.097f, 9.670f, 10.286f, 10.946f, 11.646f, 12.382f,
+	 13.145f, 13.934f, 14.753f, 15.612f, 16.519f, 17.475f, 18.484f,
+	 19.549f, 20.671f, 21.853f, 23.095f, 24.396f, 25.756f, 27.169f,
+	 28.635f, 30.158f, 31.738f, 33.373f, 35.069f, 36.831f, 38.665f,
+	 40.568f, 42.542f, 44.585f, 46.696f, 48.866f, 51.099f},
+	{11.028f, 9.689f, 8.332f, 7.014f, 5.777f, 4.651f, 3.653f, 2.791f,
+	 2.066f, 1.477f, 1.023f, 0.700f, 0.505f, 0.430f, 0.472f, 0.632f,
+	 0.908f, 1.295f, 1.796f, 2.432f, 3.216f, 4.151f, 5.156f, 6.050f,
+	 6.697f, 7.010f, 6.991f, 6.709f, 6.223f, 5.580f, 4.849f, 4.143f,
+	 3.556f, 3.152f, 2.937f, 2.858f, 2.868f, 2.930f, 3.025f, 3.145f,
+	 3.284f, 3.438f, 3.604f, 3.781f, 3.966f, 4.159f, 4.364f, 4.588f,
+	 4.839f, 5.121f, 5.435f, 5.778f, 6.147f, 6.541f, 6.958f, 7.400f,
+	 7.867f, 8.361f, 8.883f, 9.443f, 10.045f, 10.690f, 11.377f, 12.098f,
+	 12.847f, 13.620f, 14.422f, 15.266f, 16.156f, 17.096f, 18.089f,
+	 19.137f, 20.244f, 21.408f, 22.633f, 23.917f, 25.260f, 26.656f,
+	 28.108f, 29.615f, 31.180f, 32.801f, 34.483f, 36.233f, 38.055f,
+	 39.948f, 41.913f, 43.950f, 46.058f, 48.228f, 50.463f},
+	{11.044f, 9.711f, 8.359f, 7.044f, 5.810f, 4.685f, 3.688f, 2.825f,
+	 2.100f, 1.511f, 1.055f, 0.731f, 0.535f, 0.460f, 0.501f, 0.661f,
+	 0.937f, 1.325f, 1.826f, 2.461f, 3.245f, 4.180f, 5.184f, 6.077f,
+	 6.724f, 7.035f, 7.015f, 6.730f, 6.242f, 5.596f, 4.860f, 4.149f,
+	 3.558f, 3.151f, 2.933f, 2.852f, 2.858f, 2.917f, 3.007f, 3.121f,
+	 3.254f, 3.402f, 3.560f, 3.729f, 3.906f, 4.091f, 4.287f, 4.503f,
+	 4.744f, 5.016f, 5.319f, 5.651f, 6.009f, 6.391f, 6.796f, 7.225f,
+	 7.680f, 8.160f, 8.669f, 9.215f, 9.802f, 10.434f, 11.107f, 11.813f,
+	 12.547f, 13.304f, 14.091f, 14.918f, 15.791f, 16.715f, 17.691f,
+	 18.724f, 19.813f, 20.961f, 22.168f, 23.435f, 24.760f, 26.140f,
+	 27.575f, 29.067f, 30.617f, 32.223f, 33.890f, 35.626f, 37.435f,
+	 39.317f, 41.272f, 43.302f, 45.404f, 47.571f, 49.807f},
+	{11.061f, 9.733f, 8.385f, 7.074f, 5.842f, 4.719f, 3.722f, 2.860f,
+	 2.134f, 1.544f, 1.087f, 0.762f, 0.565f, 0.489f, 0.530f, 0.690f,
+	 0.966f, 1.354f, 1.855f, 2.491f, 3.274f, 4.209f, 5.212f, 6.105f,
+	 6.750f, 7.060f, 7.038f, 6.752f, 6.261f, 5.611f, 4.871f, 4.156f,
+	 3.560f, 3.150f, 2.930f, 2.846f, 2.849f, 2.903f, 2.989f, 3.097f,
+	 3.224f, 3.365f, 3.516f, 3.677f, 3.846f, 4.023f, 4.211f, 4.417f,
+	 4.649f, 4.911f, 5.203f, 5.523f, 5.870f, 6.240f, 6.633f, 7.050f,
+	 7.492f, 7.959f, 8.454f, 8.986f, 9.560f, 10.178f, 10.836f, 11.528f,
+	 12.247f, 12.988f, 13.758f, 14.568f, 15.425f, 16.333f, 17.293f,
+	 18.308f, 19.381f, 20.511f, 21.701f, 22.950f, 24.258f, 25.620f,
+	 27.039f, 28.515f, 30.048f, 31.638f, 33.290f, 35.012f, 36.807f,
+	 38.676f, 40.620f, 42.641f, 44.735f, 46.899f, 49.133f},
+	{11.077f, 9.756f, 8.412f, 7.104f, 5.874f, 4.753f, 3.757f, 2.894f,
+	 2.168f, 1.577f, 1.119f, 0.793f, 0.595f, 0.518f, 0.559f, 0.719f,
+	 0.995f, 1.383f, 1.884f, 2.520f, 3.304f, 4.238f, 5.240f, 6.132f,
+	 6.776f, 7.085f, 7.062f, 6.774f, 6.280f, 5.627f, 4.882f, 4.162f,
+	 3.563f, 3.149f, 2.926f, 2.839f, 2.839f, 2.890f, 2.970f, 3.074f,
+	 3.194f, 3.328f, 3.472f, 3.625f, 3.786f, 3.955f, 4.134f, 4.331f,
+	 4.554f, 4.805f, 5.087f, 5.396f, 5.731f, 6.089f, 6.470f, 6.874f,
+	 7.304f, 7.757f, 8.239f, 8.757f, 9.316f, 9.920f, 10.565f, 11.242f,
+	 11.945f, 12.671f, 13.424f, 14.218f, 15.058f, 15.949f, 16.892f,
+	 17.891f, 18.947f, 20.059f, 21.231f, 22.462f, 23.752f, 25.097f,
+	 26.499f, 27.958f, 29.475f, 31.049f, 32.684f, 34.390f, 36.171f,
+	 38.027f, 39.958f, 41.968f, 44.054f, 46.212f, 48.442f},
+	{11.093f, 9.778f, 8.438f, 7.134f, 5.907f, 4.787f, 3.791f, 2.929f,
+	 2.202f, 1.610f, 1.151f, 0.824f, 0.624f, 0.547f, 0.588f, 0.747f,
+	 1.024f, 1.412f, 1.914f, 2.550f, 3.333f, 4.266f, 5.268f, 6.159f,
+	 6.802f, 7.110f, 7.085f, 6.795f, 6.299f, 5.642f, 4.893f, 4.169f,
+	 3.565f, 3.148f, 2.922f, 2.833f, 2.830f, 2.876f, 2.952f, 3.050f,
+	 3.164f, 3.291f, 3.427f, 3.573f, 3.726f, 3.886f, 4.057f, 4.245f,
+	 4.458f, 4.700f, 4.970f, 5.268f, 5.591f, 5.938f, 6.306f, 6.698f,
+	 7.115f, 7.555f, 8.023f, 8.527f, 9.073f, 9.662f, 10.292f, 10.955f,
+	 11.643f, 12.352f, 13.090f, 13.866f, 14.689f, 15.563f, 16.490f,
+	 17.472f, 18.510f, 19.605f, 20.758f, 21.971f, 23.243f, 24.571f,
+	 25.955f, 27.397f, 28.897f, 30.454f, 32.073f, 33.763f, 35.528f,
+	 37.369f, 39.287f, 41.285f, 43.361f, 45.510f, 47.735f},
+	{11.110f, 9.800f, 8.465f, 7.163f, 5.939f, 4.820f, 3.826f, 2.963f,
+	 2.236f, 1.643f, 1.183f, 0.854f, 0.654f, 0.576f, 0.617f, 0.776f,
+	 1.052f, 1.441f, 1.943f, 2.579f, 3.362f, 4.295f, 5.296f, 6.186f,
+	 6.828f, 7.135f, 7.109f, 6.817f, 6.318f, 5.657f, 4.904f, 4.175f,
+	 3.568f, 3.147f, 2.919f, 2.826f, 2.820f, 2.863f, 2.934f, 3.026f,
+	 3.134f, 3.254f, 3.383f, 3.520f, 3.665f, 3.817f, 3.979f, 4.159f,
+	 4.363f, 4.594f, 4.854f, 5.140f, 5.452f, 5.786f, 6.142f, 6.522f,
+	 6.926f, 7.353f, 7.807f, 8.297f, 8.828f, 9.403f, 10.019f, 10.667f,
+	 11.340f, 12.033f, 12.754f, 13.513f, 14.320f, 15.177f, 16.087f,
+	 17.052f, 18.073f, 19.150f, 20.284f, 21.479f, 22.732f, 24.042f,
+	 25.408f, 26.832f, 28.315f, 29.855f, 31.457f, 33.130f, 34.878f,
+	 36.704f, 38.608f, 40.592f, 42.657f, 44.796f, 47.014f},
+	{11.126f, 9.822f, 8.491f, 7.193f, 5.971f, 4.854f, 3.860f, 2.998f,
+	 2.270f, 1.676f, 1.215f, 0.885f, 0.684f, 0.605f, 0.645f, 0.804f,
+	 1.081f, 1.469f, 1.972f, 2.608f, 3.391f, 4.324f, 5.324f, 6.213f,
+	 6.854f, 7.160f, 7.132f, 6.839f, 6.336f, 5.673f, 4.915f, 4.182f,
+	 3.570f, 3.146f, 2.915f, 2.820f, 2.811f, 2.849f, 2.915f, 3.002f,
+	 3.104f, 3.217f, 3.338f, 3.468f, 3.605f, 3.749f, 3.902f, 4.073f,
+	 4.267f, 4.488f, 4.737f, 5.012f, 5.312f, 5.634f, 5.978f, 6.346f,
+	 6.736f, 7.150f, 7.590f, 8.066f, 8.583f, 9.144f, 9.746f, 10.379f,
+	 11.036f, 11.713f, 12.417f, 13.160f, 13.949f, 14.789f, 15.682f,
+	 16.630f, 17.633f, 18.692f, 19.808f, 20.984f, 22.218f, 23.510f,
+	 24.858f, 26.265f, 27.730f, 29.252f, 30.836f, 32.491f, 34.223f,
+	 36.032f, 37.920f, 39.891f, 41.943f, 44.072f, 46.280f},
+	{11.142f, 9.843f, 8.518f, 7.223f, 6.003f, 4.887f, 3.894f, 3.032f,
+	 2.304f, 1.709f, 1.247f, 1.244f, 1.244f, 1.244f, 1.244f, 1.244f,
+	 1.244f, 1.498f, 2.001f, 2.638f, 3.420f, 4.353f, 5.352f, 6.240f,
+	 6.880f, 7.185f, 7.156f, 6.860f, 6.355f, 5.688f, 4.926f, 4.188f,
+	 3.573f, 3.145f, 2.911f, 2.814f, 2.801f, 2.836f, 2.897f, 2.978f,
+	 3.073f, 3.179f, 3.293f, 3.415f, 3.544f, 3.680f, 3.825f, 3.987f,
+	 4.171f, 4.382f, 4.620f, 4.883f, 5.171f, 5.482f, 5.814f, 6.169f,
+	 6.546f, 6.946f, 7.373f, 7.835f, 8.338f, 8.884f, 9.471f, 10.090f,
+	 10.732f, 11.393f, 12.080f, 12.805f, 13.577f, 14.400f, 15.276f,
+	 16.207f, 17.192f, 18.233f, 19.330f, 20.487f, 21.703f, 22.976f,
+	 24.306f, 25.694f, 27.141f, 28.644f, 30.210f, 31.848f, 33.562f,
+	 35.354f, 37.227f, 39.182f, 41.220f, 43.336f, 45.534f},
+	{11.158f, 9.865f, 8.544f, 7.252f, 6.035f, 4.920f, 3.928f, 3.066f,
+	 2.337f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f, 2.244f,
+	 2.244f, 2.244f, 2.244f, 2.667f, 3.450f, 4.381f, 5.380f, 6.267f,
+	 6.906f, 7.209f, 7.179f, 6.882f, 6.374f, 5.703f, 4.937f, 4.195f,
+	 3.575f, 3.144f, 2.908f, 2.807f, 2.792f, 2.822f, 2.879f, 2.954f,
+	 3.043f, 3.142f, 3.249f, 3.363f, 3.484f, 3.611f, 3.747f, 3.900f,
+	 4.075f, 4.275f, 4.502f, 4.755f, 5.031f, 5.330f, 5.649f, 5.991f,
+	 6.356f, 6.743f, 7.156f, 7.603f, 8.092f, 8.624f, 9.197f, 9.800f,
+	 10.427f, 11.071f, 11.742f, 12.450f, 13.205f, 14.010f, 14.869f,
+	 15.782f, 16.750f, 17.773f, 18.851f, 19.988f, 21.185f, 22.439f,
+	 23.751f, 25.121f, 26.549f, 28.034f, 29.581f, 31.200f, 32.896f,
+	 34.670f, 36.526f, 38.465f, 40.489f, 42.592f, 44.778f},
+	{11.174f, 9.887f, 8.570f, 7.282f, 6.066f, 4.954f, 3.962f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.244f, 3.479f, 4.410f, 5.408f, 6.293f,
+	 6.931f, 7.234f, 7.202f, 6.903f, 6.393f, 5.719f, 4.948f, 4.202f,
+	 3.577f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f, 3.244f,
+	 3.244f, 3.244f, 3.244f, 3.310f, 3.423f, 3.542f, 3.669f, 3.813f,
+	 3.979f, 4.169f, 4.385f, 4.626f, 4.890f, 5.177f, 5.484f, 5.814f,
+	 6.165f, 6.539f, 6.938f, 7.371f, 7.845f, 8.364f, 8.921f, 9.510f,
+	 10.121f, 10.749f, 11.403f, 12.094f, 12.831f, 13.620f, 14.461f,
+	 15.357f, 16.307f, 17.311f, 18.370f, 19.488f, 20.666f, 21.901f,
+	 23.194f, 24.545f, 25.954f, 27.420f, 28.948f, 30.548f, 32.226f,
+	 33.982f, 35.820f, 37.742f, 39.750f, 41.838f, 44.012f},
+	{11.190f, 9.909f, 8.596f, 7.311f, 6.098f, 4.987f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.438f, 5.435f, 6.320f,
+	 6.957f, 7.259f, 7.226f, 6.925f, 6.412f, 5.734f, 4.959f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f, 4.244f,
+	 4.244f, 4.244f, 4.267f, 4.497f, 4.750f, 5.024f, 5.319f, 5.636f,
+	 5.975f, 6.335f, 6.720f, 7.139f, 7.599f, 8.102f, 8.646f, 9.219f,
+	 9.815f, 10.427f, 11.063f, 11.737f, 12.457f, 13.228f, 14.052f, 14.931f,
+	 15.863f, 16.848f, 17.888f, 18.986f, 20.145f, 21.361f, 22.634f,
+	 23.966f, 25.357f, 26.804f, 28.313f, 29.893f, 31.551f, 33.289f,
+	 35.108f, 37.013f, 39.004f, 41.078f, 43.237f},
+	{11.206f, 9.930f, 8.623f, 7.341f, 6.130f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.463f, 6.347f,
+	 6.982f, 7.283f, 7.249f, 6.946f, 6.431f, 5.749f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f,
+	 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.244f, 5.458f,
+	 5.784f, 6.130f, 6.501f, 6.906f, 7.352f, 7.841f, 8.370f, 8.928f,
+	 9.508f, 10.104f, 10.723f, 11.380f, 12.082f, 12.836f, 13.643f, 14.503f,
+	 15.417f, 16.383f, 17.404f, 18.483f, 19.622f, 20.818f, 22.073f,
+	 23.386f, 24.757f, 26.185f, 27.674f, 29.235f, 30.873f, 32.591f,
+	 34.392f, 36.279f, 38.253f, 40.310f, 42.453f},
+	{11.222f, 9.952f, 8.649f, 7.370f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.373f,
+	 7.008f, 7.307f, 7.272f, 6.967f, 6.450f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f, 6.244f,
+	 6.244f, 6.244f, 6.282f, 6.673f, 7.104f, 7.579f, 8.093f, 8.637f,
+	 9.201f, 9.780f, 10.382f, 11.022f, 11.706f, 12.443f, 13.232f, 14.075f,
+	 14.971f, 15.918f, 16.919f, 17.979f, 19.098f, 20.275f, 21.510f,
+	 22.804f, 24.155f, 25.563f, 27.032f, 28.573f, 30.192f, 31.890f,
+	 33.671f, 35.539f, 37.495f, 39.535f, 41.663f},
+	{11.238f, 9.974f, 8.675f, 7.400f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.332f, 7.295f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.244f,
+	 7.244f, 7.244f, 7.244f, 7.244f, 7.244f, 7.317f, 7.816f, 8.345f,
+	 8.893f, 9.456f, 10.041f, 10.663f, 11.330f, 12.049f, 12.821f, 13.646f,
+	 14.524f, 15.452f, 16.434f, 17.473f, 18.572f, 19.730f, 20.946f,
+	 22.220f, 23.552f, 24.939f, 26.388f, 27.909f, 29.507f, 31.185f,
+	 32.946f, 34.795f, 36.732f, 38.755f, 40.866f},
+	{11.253f, 9.995f, 8.701f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f, 8.244f,
+	 8.585f, 9.131f, 9.700f, 10.304f, 10.954f, 11.655f, 12.409f, 13.216f,
+	 14.076f, 14.985f, 15.947f, 16.967f, 18.046f, 19.184f, 20.380f,
+	 21.634f, 22.946f, 24.314f, 25.742f, 27.242f, 28.819f, 30.477f,
+	 32.218f, 34.047f, 35.965f, 37.969f, 40.063f},
+	{11.269f, 10.017f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f, 9.244f,
+	 9.244f, 9.244f, 9.358f, 9.944f, 10.576f, 11.260f, 11.997f, 12.786f,
+	 13.627f, 14.517f, 15.460f, 16.459f, 17.518f, 18.636f, 19.813f,
+	 21.047f, 22.339f, 23.686f, 25.094f, 26.573f, 28.129f, 29.766f,
+	 31.487f, 33.296f, 35.194f, 37.179f, 39.255f},
+	{11.285f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f,
+	 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.244f, 10.864f,
+	 11.583f, 12.355f, 13.177f, 14.049f, 14.971f, 15.951f, 16.990f,
+	 18.088f, 19.244f, 20.459f, 21.730f, 23.057f, 24.444f, 25.901f,
+	 27.437f, 29.053f, 30.752f, 32.541f, 34.419f, 36.385f, 38.441f},
+	{11.301f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f, 11.244f,
+	 11.244f, 11.923f, 12.727f, 13.579f, 14.482f, 15.442f, 16.460f,
+	 17.538f, 18.675f, 19.869f, 21.120f, 22.426f, 23.792f, 25.228f,
+	 26.743f, 28.337f, 30.015f, 31.783f, 33.641f, 35.586f, 37.624f},
+	{12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f, 12.244f,
+	 12.244f, 12.244f, 12.277f, 13.109f, 13.992f, 14.932f, 15.930f,
+	 16.988f, 18.104f, 19.279f, 20.509f, 21.794f, 23.138f, 24.554f,
+	 26.046f, 27.619f, 29.276f, 31.022f, 32.859f, 34.785f, 36.802f},
+	{13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f, 13.244f,
+	 13.244f, 13.244f, 13.244f, 13.244f, 13.502f, 14.421f, 15.399f,
+	 16.436f, 17.533f, 18.687f, 19.897f, 21.161f, 22.484f, 23.877f,
+	 25.348f, 26.899f, 28.534f, 30.259f, 32.075f, 33.980f, 35.977f},
+	{14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f,
+	 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.244f, 14.867f,
+	 15.884f, 16.960f, 18.094f, 19.283f, 20.526f, 21.828f, 23.200f,
+	 24.648f, 26.177f, 27.790f, 29.494f, 31.288f, 33.172f, 35.148f},
+	{15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f, 15.244f,
+	 15.332f, 16.387f, 17.501f, 18.669f, 19.891f, 21.171f, 22.521f,
+	 23.947f, 25.454f, 27.045f, 28.726f, 30.499f, 32.361f, 34.317f},
+	{16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f, 16.244f,
+	 16.244f, 16.244f, 16.906f, 18.054f, 19.254f, 20.513f, 21.840f,
+	 23.245f, 24.729f, 26.298f, 27.957f, 29.707f, 31.548f, 33.483f},
+	{17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f, 17.244f,
+	 17.244f, 17.244f, 17.244f, 17.438f, 18.617f, 19.853f, 21.159f,
+	 22.541f, 24.003f, 25.549f, 27.186f, 28.914f, 30.734f, 32.646f},
+	{18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 18.244f,
+	 18.244f, 18.244f, 18.244f, 18.244f, 18.244f, 19.193f, 20.477f,
+	 21.837f, 23.276f, 24.800f, 26.414f, 28.120f, 29.917f, 31.808f},
+	{19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f,
+	 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.244f, 19.794f,
+	 21.131f, 22.548f, 24.048f, 25.640f, 27.323f, 29.098f, 30.967f},
+	{20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f, 20.244f,
+	 20.425f, 21.818f, 23.296f, 24.865f, 26.526f, 28.278f, 30.125f},
+	{21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f, 21.244f,
+	 21.244f, 21.244f, 22.543f, 24.089f, 25.727f, 27.457f, 29.281f},
+	{22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f, 22.244f,
+	 22.244f, 22.244f, 22.244f, 23.312f, 24.927f, 26.634f, 28.436f},
+	{23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f, 23.244f,
+	 23.244f, 23.244f, 23.244f, 23.244f, 24.126f, 25.810f, 27.589f},
+	{24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.244f,
+	 24.244f, 24.244f, 24.244f, 24.244f, 24.244f, 24.986f, 26.742f},
+	{25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f,
+	 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.244f, 25.893f},
+	{26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f,
+	 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f, 26.244f}
 };
 
 /* End of automatically generated file */
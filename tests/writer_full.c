@@ -0,0 +1,83 @@
+/*
+ * writer_full.c
+ *
+ * Copyright 2019 Juan I Carrano <juan@carrano.com.ar>
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ */
+
+/* Record to /dev/full, where every write fails with ENOSPC. The writer must
+ * report the error and keep its buffers intact while the caller goes on
+ * putting frames, as the recorder and the batch workers do. Built with
+ * AddressSanitizer by "make check". */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <semaphore.h>
+#include <libjc/common.h>
+#include "../src/rtfi.h"
+#include "../src/framewriter.h"
+
+#define N_FRAMES (5 * FF_CHUNK_FRAMES)
+
+static int check(const char *path, int qbits, int delta)
+{
+	float frame[ARTFI_BSIZE];
+	struct ff_writer *w;
+	int i, r, errors = 0;
+
+	for (i = 0; i < ARTFI_BSIZE; i++)
+		frame[i] = 1e-3f * (float)(i + 1);
+
+	if ((w = ff_writer_open(path, qbits, delta, 48000, 480, 0, &r))
+								== NULL) {
+		/* the header may already fail, if it is not buffered */
+		return r == -E_OTHER? 0 : 1;
+	}
+
+	for (i = 0; i < N_FRAMES; i++)
+		if (ff_writer_put(w, (uint64_t)i, 10000000 * (int64_t)i,
+							frame) != -E_OK)
+			errors++;
+
+	if (errors == 0) {
+		PERROR("%d bits: no write error in %d frames\n", qbits,
+								N_FRAMES);
+		return 1;
+	}
+
+	if (ff_writer_close(w) != -E_OTHER) {
+		PERROR("%d bits: close did not report the error\n", qbits);
+		return 1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *path = (argc > 1)? argv[1] : "/dev/full";
+	int failed = 0;
+
+	failed += check(path, 8, 0);
+	failed += check(path, 8, 1);
+	failed += check(path, 16, 0);
+	failed += check(path, 16, 1);
+
+	printf("writer_full: %s\n", failed? "FAILED" : "ok");
+
+	return failed? 1 : 0;
+}